@@ -0,0 +1,231 @@
+#include "Benchmark.h"
+#include "Core/AllocationCounter.h"
+#include "Core/Ecosystem.h"
+#include "Graphics/Camera.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/StaticLayer.h"
+#include <SDL3/SDL.h>
+#include <algorithm> // Pour std::sort
+#include <chrono>
+#include <cmath>   // Pour std::sqrt
+#include <cstdio>  // Pour std::printf
+#include <memory>  // Pour std::unique_ptr
+
+namespace Ecosystem
+{
+    namespace Bench
+    {
+
+        namespace
+        {
+            constexpr float kTimeStep = 1.0f / 60.0f;
+            constexpr float kAreaPerEntity = 2000.0f; // px² : densité constante quelle que soit la taille
+            constexpr int kRenderWidth = 1280;
+            constexpr int kRenderHeight = 720;
+
+            using Clock = std::chrono::steady_clock;
+
+            double ElapsedMs(Clock::time_point start)
+            {
+                return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            }
+
+            // Percentile par rang le plus proche (échantillons déjà triés)
+            double Percentile(const std::vector<double> &sorted, double fraction)
+            {
+                std::size_t rank = static_cast<std::size_t>(fraction * (sorted.size() - 1) + 0.5);
+                return sorted[rank];
+            }
+
+            // Un écosystème de "entities" individus : 40 % d'herbivores, 10 % de carnivores, 50 % de plantes
+            std::unique_ptr<Core::Ecosystem> MakeEcosystem(const Settings &settings, std::size_t entities, int maxEntities)
+            {
+                float side = std::sqrt(static_cast<float>(entities) * kAreaPerEntity);
+                auto ecosystem = std::make_unique<Core::Ecosystem>(side * 1.5f, side / 1.5f, maxEntities);
+                ecosystem->SetSeed(settings.seed);
+
+                int herbivores = static_cast<int>(entities * 4 / 10);
+                int carnivores = static_cast<int>(entities / 10);
+                int plants = static_cast<int>(entities) - herbivores - carnivores;
+                ecosystem->Initialize(herbivores, carnivores, plants);
+                return ecosystem;
+            }
+
+            // Met en forme les mesures brutes
+            Result Summarize(const std::string &scenario, std::size_t entities, std::vector<double> durationsMs,
+                             double entityTicks, uint64_t allocations, std::size_t ticks)
+            {
+                Result result;
+                result.scenario = scenario;
+                result.entities = entities;
+                result.samples = durationsMs.size();
+                if (durationsMs.empty())
+                    return result;
+
+                double totalMs = 0.0;
+                for (double duration : durationsMs)
+                {
+                    totalMs += duration;
+                }
+                std::sort(durationsMs.begin(), durationsMs.end());
+
+                result.meanMs = totalMs / durationsMs.size();
+                result.p50Ms = Percentile(durationsMs, 0.50);
+                result.p90Ms = Percentile(durationsMs, 0.90);
+                result.p99Ms = Percentile(durationsMs, 0.99);
+                result.maxMs = durationsMs.back();
+                result.nsPerEntityTick = entityTicks > 0.0 ? totalMs * 1e6 / entityTicks : 0.0;
+                result.allocationsPerTick = ticks > 0 ? static_cast<double>(allocations) / ticks : 0.0;
+                return result;
+            }
+
+            // Un seul Update mesuré sur un écosystème préparé par "prepare" (rafale, hécatombe)
+            template <typename Prepare>
+            Result BenchSingleTick(const Settings &settings, const std::string &scenario, std::size_t entities,
+                                   Prepare prepare)
+            {
+                std::vector<double> durations;
+                double entityTicks = 0.0;
+                uint64_t allocations = 0;
+                int repetitions = std::max(3, settings.samples / 6);
+
+                for (int rep = 0; rep < repetitions; ++rep)
+                {
+                    auto ecosystem = MakeEcosystem(settings, entities, static_cast<int>(entities * 3));
+                    prepare(ecosystem->GetEntityStore());
+
+                    std::size_t population = ecosystem->GetEntityCount();
+                    uint64_t allocationsBefore = Core::GetAllocationCount();
+                    auto start = Clock::now();
+                    ecosystem->Update(kTimeStep);
+                    durations.push_back(ElapsedMs(start));
+                    allocations += Core::GetAllocationCount() - allocationsBefore;
+                    entityTicks += population;
+                }
+                return Summarize(scenario, entities, durations, entityTicks, allocations, repetitions);
+            }
+        }
+
+        // 🌱 CRÉATION DU MONDE
+        Result BenchInitialize(const Settings &settings, std::size_t entities)
+        {
+            std::vector<double> durations;
+            double entityTicks = 0.0;
+            uint64_t allocations = 0;
+            int repetitions = std::max(3, settings.samples / 6);
+
+            for (int rep = 0; rep < repetitions; ++rep)
+            {
+                uint64_t allocationsBefore = Core::GetAllocationCount();
+                auto start = Clock::now();
+                auto ecosystem = MakeEcosystem(settings, entities, static_cast<int>(entities));
+                durations.push_back(ElapsedMs(start));
+                allocations += Core::GetAllocationCount() - allocationsBefore;
+                entityTicks += ecosystem->GetEntityCount();
+            }
+            return Summarize("initialize", entities, durations, entityTicks, allocations, repetitions);
+        }
+
+        // 🔄 RÉGIME ÉTABLI
+        Result BenchSteadyUpdate(const Settings &settings, std::size_t entities)
+        {
+            auto ecosystem = MakeEcosystem(settings, entities, static_cast<int>(entities * 2));
+            for (int tick = 0; tick < settings.warmupTicks; ++tick)
+            {
+                ecosystem->Update(kTimeStep);
+            }
+
+            std::vector<double> durations;
+            double entityTicks = 0.0;
+            uint64_t allocationsBefore = Core::GetAllocationCount();
+            for (int tick = 0; tick < settings.samples; ++tick)
+            {
+                entityTicks += ecosystem->GetEntityCount();
+                auto start = Clock::now();
+                ecosystem->Update(kTimeStep);
+                durations.push_back(ElapsedMs(start));
+            }
+            uint64_t allocations = Core::GetAllocationCount() - allocationsBefore;
+            return Summarize("update", entities, durations, entityTicks, allocations, settings.samples);
+        }
+
+        // 👶 RAFALE DE NAISSANCES : tous les animaux sont prêts à se reproduire au même tick
+        Result BenchReproductionBurst(const Settings &settings, std::size_t entities)
+        {
+            return BenchSingleTick(settings, "reproduction-burst", entities, [](Core::EntityStore &store)
+                                   {
+                                       for (std::size_t i = 0; i < store.Size(); ++i)
+                                       {
+                                           store.energy[i] = store.maxEnergy[i];
+                                           store.age[i] = 25.0f;
+                                       } });
+        }
+
+        // 💀 HÉCATOMBE : toute la population atteint son âge maximal au même tick
+        Result BenchDieOff(const Settings &settings, std::size_t entities)
+        {
+            return BenchSingleTick(settings, "die-off", entities, [](Core::EntityStore &store)
+                                   {
+                                       for (std::size_t i = 0; i < store.Size(); ++i)
+                                       {
+                                           store.age[i] = static_cast<float>(store.maxAge[i]);
+                                       } });
+        }
+
+        // 🎨 RENDU DANS UN RENDERER LOGICIEL (sans fenêtre)
+        Result BenchRender(const Settings &settings, std::size_t entities)
+        {
+            SDL_Surface *surface = SDL_CreateSurface(kRenderWidth, kRenderHeight, SDL_PIXELFORMAT_RGBA8888);
+            SDL_Renderer *sdlRenderer = surface ? SDL_CreateSoftwareRenderer(surface) : nullptr;
+            if (!sdlRenderer)
+            {
+                std::printf("render: renderer logiciel indisponible (%s)\n", SDL_GetError());
+                if (surface)
+                    SDL_DestroySurface(surface);
+                return Summarize("render", entities, {}, 0.0, 0, 0);
+            }
+
+            auto ecosystem = MakeEcosystem(settings, entities, static_cast<int>(entities));
+            Graphics::Renderer renderer(sdlRenderer);
+            Graphics::StaticLayer staticLayer;
+            Graphics::Camera camera; // Tout le monde visible
+            camera.Configure(ecosystem->GetWorldWidth(), ecosystem->GetWorldHeight(), kRenderWidth, kRenderHeight);
+
+            std::vector<double> durations;
+            double entityTicks = 0.0;
+            uint64_t allocationsBefore = Core::GetAllocationCount();
+            for (int frame = 0; frame < settings.samples; ++frame)
+            {
+                entityTicks += ecosystem->GetEntityCount();
+                auto start = Clock::now();
+                renderer.Begin();
+                ecosystem->Render(renderer, staticLayer, camera, 1.0f);
+                renderer.Flush();
+                durations.push_back(ElapsedMs(start));
+            }
+            uint64_t allocations = Core::GetAllocationCount() - allocationsBefore;
+
+            staticLayer.Release();
+            SDL_DestroyRenderer(sdlRenderer);
+            SDL_DestroySurface(surface);
+            return Summarize("render", entities, durations, entityTicks, allocations, settings.samples);
+        }
+
+        // 🖨 TABLEAU DES RÉSULTATS
+        void PrintHeader()
+        {
+            std::printf("%-20s %8s %7s %10s %10s %10s %10s %10s %12s %12s\n",
+                        "scenario", "entities", "samples", "mean ms", "p50 ms", "p90 ms", "p99 ms", "max ms",
+                        "ns/ent/tick", "allocs/tick");
+        }
+
+        void PrintResult(const Result &result)
+        {
+            std::printf("%-20s %8zu %7zu %10.3f %10.3f %10.3f %10.3f %10.3f %12.1f %12.1f\n",
+                        result.scenario.c_str(), result.entities, result.samples, result.meanMs, result.p50Ms,
+                        result.p90Ms, result.p99Ms, result.maxMs, result.nsPerEntityTick, result.allocationsPerTick);
+            std::fflush(stdout);
+        }
+
+    } // namespace Bench
+} // namespace Ecosystem
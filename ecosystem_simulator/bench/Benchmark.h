@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef> // Pour std::size_t
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Bench
+    {
+
+        // ⚙ RÉGLAGES D'UNE CAMPAGNE
+        struct Settings
+        {
+            std::vector<std::size_t> sizes = {1000, 10000, 100000}; // Populations testées
+            int samples = 30;      // Répétitions (ou ticks mesurés) par scénario
+            int warmupTicks = 60;  // Ticks joués avant de mesurer le régime établi
+            uint64_t seed = 12345; // Graine fixe : deux campagnes jouent la même simulation
+            std::string filter;    // Ne lance que les scénarios dont le nom contient ce texte
+        };
+
+        // 📈 RÉSULTAT D'UN SCÉNARIO
+        struct Result
+        {
+            std::string scenario;
+            std::size_t entities = 0;      // Population au départ du scénario
+            std::size_t samples = 0;
+            double meanMs = 0.0;
+            double p50Ms = 0.0;
+            double p90Ms = 0.0;
+            double p99Ms = 0.0;
+            double maxMs = 0.0;
+            double nsPerEntityTick = 0.0;  // Temps total / somme des populations traitées
+            double allocationsPerTick = 0.0;
+        };
+
+        // 🏁 SCÉNARIOS (chacun construit ses propres écosystèmes)
+        Result BenchInitialize(const Settings &settings, std::size_t entities);
+        Result BenchSteadyUpdate(const Settings &settings, std::size_t entities);
+        Result BenchReproductionBurst(const Settings &settings, std::size_t entities);
+        Result BenchDieOff(const Settings &settings, std::size_t entities);
+        Result BenchRender(const Settings &settings, std::size_t entities);
+
+        // 🖨 AFFICHAGE
+        void PrintHeader();
+        void PrintResult(const Result &result);
+
+    } // namespace Bench
+} // namespace Ecosystem
@@ -0,0 +1,101 @@
+// bench/main.cpp
+
+// 📏 BANC D'ESSAI DU CŒUR DE LA SIMULATION
+// Scénarios reproductibles (graine fixe) joués directement sur Ecosystem, sans fenêtre.
+// Chaque changement de performance doit être comparé à une exécution de référence.
+
+#include "Benchmark.h"
+#include "Core/EntityKernel.h"
+#include "Core/Logger.h"
+#include <algorithm> // Pour std::max
+#include <cstdio>
+#include <cstdlib>
+#include <cstring> // Pour std::strcmp, std::strstr
+#include <functional>
+
+// 📖 AIDE DE LA LIGNE DE COMMANDE
+static void PrintUsage(const char *program)
+{
+    std::printf("Usage: %s [options]\n", program);
+    std::printf("  --quick         Populations 1k et 10k seulement, moins d'échantillons\n");
+    std::printf("  --samples N     Ticks (ou images) mesurés par scénario (défaut 30)\n");
+    std::printf("  --seed N        Graine du monde (défaut 12345)\n");
+    std::printf("  --isa NOM       Noyau de mise à jour : scalar, sse2 ou avx2 (défaut : le meilleur disponible)\n");
+    std::printf("  --filter TEXTE  Ne lance que les scénarios dont le nom contient TEXTE\n");
+    std::printf("  --help          Affiche cette aide\n");
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace Ecosystem;
+
+    // 🧾 LECTURE DES ARGUMENTS
+    Bench::Settings settings;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--quick") == 0)
+        {
+            settings.sizes = {1000, 10000};
+            settings.samples = 12;
+            settings.warmupTicks = 20;
+        }
+        else if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+        {
+            settings.samples = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            settings.seed = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (std::strcmp(argv[i], "--isa") == 0 && i + 1 < argc)
+        {
+            const char *name = argv[++i];
+            for (auto isa : {Core::EntityKernel::InstructionSet::Scalar, Core::EntityKernel::InstructionSet::SSE2,
+                             Core::EntityKernel::InstructionSet::AVX2})
+            {
+                if (std::strcmp(name, Core::EntityKernel::GetInstructionSetName(isa)) == 0)
+                    Core::EntityKernel::SetInstructionSet(isa);
+            }
+        }
+        else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            settings.filter = argv[++i];
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : -1;
+        }
+    }
+
+    // Les messages de l'écosystème (création, graine...) fausseraient les mesures
+    Core::Logger::Instance().SetLevel(Core::LogLevel::Warning);
+
+    struct Scenario
+    {
+        const char *name;
+        std::function<Bench::Result(const Bench::Settings &, std::size_t)> run;
+    };
+    const Scenario scenarios[] = {
+        {"initialize", Bench::BenchInitialize},
+        {"update", Bench::BenchSteadyUpdate},
+        {"reproduction-burst", Bench::BenchReproductionBurst},
+        {"die-off", Bench::BenchDieOff},
+        {"render", Bench::BenchRender},
+    };
+
+    std::printf("Graine %llu, %d échantillons par scénario, noyau %s\n",
+                static_cast<unsigned long long>(settings.seed), settings.samples,
+                Core::EntityKernel::GetInstructionSetName(Core::EntityKernel::GetInstructionSet()));
+    Bench::PrintHeader();
+    for (const Scenario &scenario : scenarios)
+    {
+        if (!settings.filter.empty() && !std::strstr(scenario.name, settings.filter.c_str()))
+            continue;
+        for (std::size_t entities : settings.sizes)
+        {
+            Bench::PrintResult(scenario.run(settings, entities));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🔢 COMPTEUR D'ALLOCATIONS
+        // AllocationCounter.cpp remplace l'opérateur new global : chaque allocation, sur
+        // n'importe quel thread, incrémente ce compteur (un simple atomique relâché).
+        // Compilé avec ECOSYSTEM_TRACK_ALLOCATIONS=0, le compteur reste à zéro.
+        uint64_t GetAllocationCount();
+
+        // true si les allocations sont réellement comptées dans ce binaire
+        bool IsAllocationCountingEnabled();
+
+    } // namespace Core
+} // namespace Ecosystem
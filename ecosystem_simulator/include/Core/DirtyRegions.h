@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef> // Pour std::size_t
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🧽 RÉGIONS À REDESSINER
+        // Le monde est découpé en tuiles carrées de kTileSize pixels. Chaque changement du
+        // décor immobile (nourriture posée ou mangée, plante apparue, morte ou qui change de
+        // couleur) marque les tuiles que touche son carré ; le rendu ne redessine que ces
+        // tuiles dans la couche statique (Graphics::StaticLayer), puis efface les marques.
+        // Sans rendu (mode headless), les marques s'accumulent simplement : rien ne grossit.
+        //
+        // Les tuiles marquées sont aussi gardées en liste : les parcourir ou les effacer coûte
+        // le nombre de tuiles marquées, pas la taille du monde.
+        class DirtyRegions
+        {
+        public:
+            static constexpr float kTileSize = 64.0f;
+
+            DirtyRegions(float worldWidth = 1.0f, float worldHeight = 1.0f);
+
+            void Configure(float worldWidth, float worldHeight);
+
+            // Carré de centre (x, y) et de demi-côté halfSize
+            void Mark(float x, float y, float halfSize);
+            void MarkAll();
+            void Clear();
+
+            // 🔍 LECTURE
+            bool IsEmpty() const { return mDirtyList.empty(); }
+
+            // visitor(x, y, largeur, hauteur) pour chaque tuile marquée (en pixels du monde),
+            // dans l'ordre des marques
+            template <typename Visitor>
+            void ForEachDirtyTile(Visitor &&visitor) const
+            {
+                for (uint32_t tile : mDirtyList)
+                {
+                    int column = static_cast<int>(tile % static_cast<uint32_t>(mColumns));
+                    int row = static_cast<int>(tile / static_cast<uint32_t>(mColumns));
+                    visitor(column * kTileSize, row * kTileSize, kTileSize, kTileSize);
+                }
+            }
+
+        private:
+            int mColumns;
+            int mRows;
+            std::vector<uint8_t> mTiles;      // 1 = à redessiner
+            std::vector<uint32_t> mDirtyList; // Index des tuiles à 1 (capacité réservée pour toutes)
+
+            // Tuiles couvertes par le carré, bornées au monde
+            void TileRange(float x, float y, float halfSize, int &firstColumn, int &lastColumn,
+                           int &firstRow, int &lastRow) const;
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -1,10 +1,19 @@
 #pragma once
 #include "Entity.h"
 #include "Structs.h"
+#include "DirtyRegions.h"
+#include "EntityStore.h"
+#include "JobSystem.h"
+#include "LodScheduler.h"
+#include "SpatialGrid.h"
+#include "ScratchArena.h"
+#include "Profiler.h"
+#include "StatisticsSeries.h"
+#include "WorldConfig.h"
 #include <vector>     //  pour std::vector
-#include <memory>     //  pour std::unique_ptr
-#include <random>     // Pour std::mt19937
-#include <SDL3/SDL.h> // pour SDL_Renderer*
+#include "Graphics/Renderer.h" // pour le rendu par lots
+#include "Graphics/Camera.h" // pour la zone visible
+#include "Graphics/StaticLayer.h" // pour le décor mis en cache
 
 namespace Ecosystem
 {
@@ -13,22 +22,91 @@ namespace Ecosystem
 
         class Ecosystem
         {
+            // La sauvegarde binaire lit et remplace directement l'état interne
+            friend class Snapshot;
+
         private:
             // ÉTAT INTERNE
             // C'est ici que l'on stocke tous les animaux.
-            // On utilise unique_ptr pour que l'écosystème soit le "propriétaire" de la mémoire.
-            std::vector<std::unique_ptr<Entity>> mEntities;
+            // Le stockage en tableaux contigus (SoA) est le "propriétaire" des données ;
+            // les objets Entity ne sont que des poignées vers une de ses colonnes.
+            EntityStore mEntities;
+
+            // Mémoire temporaire du tick (naissances en attente...), remise à zéro à chaque Update
+            ScratchArena mScratch;
+
+            // Durée de chaque phase d'Update, tick par tick
+            Profiler mProfiler;
+
+            // Population, énergie moyenne, naissances, morts... tick par tick
+            StatisticsSeries mSeries;
+            // Entités mortes pendant le tick (faim, vieillesse, prédation), repérées au moment
+            // de leur mort : le retrait ne parcourt jamais toute la population
+            std::vector<std::size_t> mDeadEntities;
 
             // Les sources de nourriture (objets simples, pas de pointeurs nécessaires)
             std::vector<Food> mFoodSources;
 
-            float mWorldWidth;
-            float mWorldHeight;
-            int mMaxEntities;
+            // Taille du monde, limites et paramètres (voir WorldConfig)
+            WorldConfig mConfig;
             int mDayCycle;
 
-            // Générateur aléatoire
-            std::mt19937 mRandomGenerator;
+            // Nombre de tirages aléatoires faits par l'écosystème lui-même (apparitions,
+            // pousse des plantes) : c'est le "tick" de la clé RandomService::kWorldKey
+            uint64_t mWorldDraws;
+
+            // INDEX SPATIAUX (reconstruits à chaque tick)
+            // Ils permettent de trouver les voisins sans parcourir toute la population.
+            SpatialGrid mEntityGrid;
+            SpatialGrid mFoodGrid;
+            std::vector<uint8_t> mFoodEaten; // Nourriture consommée pendant le tick
+
+            // Le rendu interroge les mêmes grilles. Les retraits qui suivent leur construction
+            // déplacent les index : des tables ramènent chaque entrée de grille à l'index actuel,
+            // tenues à jour au retrait (coût au nombre de morts ou à la nourriture du tick, pas
+            // à l'image). Ce qui a été ajouté depuis est parcouru à part (quelques naissances,
+            // la nourriture semée).
+            static constexpr uint32_t kNotIndexed = 0xFFFFFFFF;
+            std::vector<uint32_t> mEntityRemap;           // Entrée de mEntityGrid → index actuel, ou kNotIndexed (retirée)
+            std::vector<uint32_t> mEntityItem;            // Index actuel → entrée de mEntityGrid, ou kNotIndexed (ajoutée depuis)
+            std::vector<EntityHandle> mUnindexedEntities; // Ajoutées depuis la construction
+            std::vector<uint32_t> mFoodRemap;             // Entrée de mFoodGrid → index actuel, ou kNotIndexed (mangée)
+            std::size_t mUnindexedFoodBegin;              // Nourriture ajoutée depuis : [début, fin de mFoodSources[
+
+            // Régions calmes mises à jour moins souvent (voir LodScheduler)
+            LodScheduler mLod;
+
+            // Tuiles du décor immobile (nourriture, plantes) à redessiner dans la couche statique
+            DirtyRegions mStaticDirty;
+
+            std::vector<uint32_t> mHeatmap; // Tuiles de densité : herbivores et carnivores par tuile
+
+            // PARALLÉLISME
+            // Les entités sont traitées par blocs sur le pool de threads. Chaque bloc écrit
+            // ses naissances, morts et repas dans son propre tampon ; les tampons sont ensuite
+            // fusionnés dans l'ordre des blocs, ce qui rend le résultat déterministe.
+            // Un repas visé pendant le tick. Les demandes sont triées par (sorte, cible,
+            // distance, identifiant du mangeur) : pour chaque cible, le plus proche est
+            // servi, quel que soit le découpage en blocs ou l'ordre des tableaux.
+            enum class FeedingKind : uint8_t
+            {
+                Prey,  // Carnivore → herbivore (résolu en premier : une proie tuée ne mange plus)
+                Food,  // Herbivore → nourriture
+                Plant  // Herbivore → plante (broutée, pas forcément tuée)
+            };
+            struct FeedingClaim
+            {
+                FeedingKind kind;
+                uint32_t eater;          // Index de celui qui mange
+                uint32_t target;         // Index de la nourriture, de la plante ou de la proie
+                float distanceSquared;   // Entre le mangeur et sa cible
+            };
+            JobSystem mJobs;
+            std::vector<std::vector<std::size_t>> mChunkDeaths;
+            std::vector<std::vector<std::size_t>> mChunkBirths;
+            std::vector<std::vector<FeedingClaim>> mChunkClaims;
+            std::vector<std::vector<std::size_t>> mChunkRepaints; // Plantes dont la teinte a changé
+            std::vector<EnergyLedger> mChunkEnergy; // Écarts d'énergie, reportés dans le recensement
 
         public:
             // STATISTIQUES (Structure publique pour pouvoir être lue de l'extérieur)
@@ -38,17 +116,28 @@ namespace Ecosystem
                 int totalCarnivores;
                 int totalPlants;
                 int totalFood;
-                int deathsToday;
+                int deathsToday; // Remis à zéro tous les WorldConfig::ticksPerDay ticks
                 int birthsToday;
             } mStats;
 
+            // ÉVÉNEMENTS DU DERNIER TICK (journal de rejeu, séries temporelles...)
+            struct TickEvents
+            {
+                uint32_t births;
+                uint32_t deaths; // Faim, vieillesse et prédation
+                uint32_t meals;
+            };
+
             // CONSTRUCTEUR/DESTRUCTEUR
+            // Les stockages sont réservés d'avance pour config.maxEntities et config.maxFood
+            explicit Ecosystem(const WorldConfig &config);
             Ecosystem(float width, float height, int maxEntities = 500);
             ~Ecosystem();
 
             // MÉTHODES PUBLIQUES
             // J'ai rétabli la parenthèse fermante qui manquait dans votre texte
             void Initialize(int initialHerbivores, int initialCarnivores, int initialPlants);
+            void Initialize(); // Population de départ de la configuration
 
             void Update(float deltaTime);
             void SpawnFood(int count);
@@ -57,26 +146,111 @@ namespace Ecosystem
             void HandleEating();
 
             // GETTERS
-            int GetEntityCount() const { return mEntities.size(); }
+            int GetEntityCount() const { return static_cast<int>(mEntities.Size()); }
             int GetFoodCount() const { return mFoodSources.size(); }
-            Statistics GetStatistics() const { return mStats; }
-            float GetWorldWidth() const { return mWorldWidth; }
-            float GetWorldHeight() const { return mWorldHeight; }
+            Statistics GetStatistics() const; // O(1) : totaux lus dans le recensement
+            const PopulationCensus &GetCensus() const { return mEntities.census; }
+            const TickEvents &GetTickEvents() const { return mTickEvents; }
+            int GetDayCycle() const { return mDayCycle; } // Numéro du prochain tick
+            float GetWorldWidth() const { return mConfig.worldWidth; }
+            float GetWorldHeight() const { return mConfig.worldHeight; }
+            const WorldConfig &GetConfig() const { return mConfig; }
+            uint64_t GetSeed() const { return mEntities.random.GetSeed(); }
+
+            const StatisticsSeries &GetSeries() const { return mSeries; }
+
+            Profiler &GetProfiler() { return mProfiler; }
+            const Profiler &GetProfiler() const { return mProfiler; }
+
+            // Accès direct aux tableaux (outils : banc d'essai, sauvegarde...)
+            EntityStore &GetEntityStore() { return mEntities; }
+            const EntityStore &GetEntityStore() const { return mEntities; }
+
+            // 🎲 GRAINE DU MONDE (à appeler avant Initialize pour rejouer une simulation)
+            void SetSeed(uint64_t seed);
+
+            // 🔑 EMPREINTE DE L'ÉTAT (entités, nourriture, compteurs du hasard, tick)
+            // Deux simulations dans le même état ont la même empreinte, quel que soit le
+            // nombre de threads ; sert à repérer le premier tick où deux exécutions divergent.
+            uint64_t ComputeStateHash() const;
 
             // MÉTHODES DE GESTION
-            void AddEntity(std::unique_ptr<Entity> entity);
+            // "name" vide : nommée d'après son espèce ; sinon le nom est partagé par ses descendants
+            Entity AddEntity(EntityType type, Vector2D position, const std::string &name = "");
             void AddFood(Vector2D position, float energy = 25.0f);
 
             // RENDU
-            void Render(SDL_Renderer *renderer) const;
+            // alpha : fraction du pas fixe écoulée depuis le dernier tick (interpolation).
+            // La nourriture et les plantes passent par "staticLayer" (retouché seulement là où
+            // elles ont changé) ; seules les entités mobiles sont redessinées à chaque image.
+            // Seul ce qui est dans la zone visible de "camera" est envoyé ; de loin, les entités
+            // mobiles deviennent des tuiles de densité. La vue du renderer est rétablie à la fin.
+            void Render(Graphics::Renderer &renderer, Graphics::StaticLayer &staticLayer,
+                        const Graphics::Camera &camera, float alpha = 1.0f);
 
         private:
+            TickEvents mTickEvents; // Remis à zéro au début de chaque Update
+
             // MÉTHODES PRIVÉES
+            void UpdateEntities(float deltaTime);
             void UpdateStatistics();
+            void RebuildSpatialIndex();
+            void ApplySteering(float deltaTime);
             void SpawnRandomEntity(EntityType type);
-            Vector2D GetRandomPosition() const;
+            Vector2D GetRandomPosition();
+            float WorldRandomUnit(RandomStream stream);
             void HandlePlantGrowth(float deltaTime);
+            // Marque la tuile d'une entité immobile dont le palier de teinte a changé
+            void TrackStaticTint(std::size_t index);
+            // Entité ajoutée depuis la construction des grilles (rendu, couche statique)
+            void OnEntityAdded(std::size_t index);
+            void RenderHeatmap(Graphics::Renderer &renderer, const Graphics::Camera &camera);
+
+            // Entités / nourriture du rectangle (cellules qui le touchent), par index actuel :
+            // visitor(index)
+            template <typename Visitor>
+            void ForEachEntityInRect(float minX, float minY, float maxX, float maxY, Visitor &&visitor);
+            template <typename Visitor>
+            void ForEachFoodInRect(float minX, float minY, float maxX, float maxY, Visitor &&visitor);
         };
 
+        // 📐 IMPLÉMENTATION DES REQUÊTES DU RENDU (templates : doivent rester dans le .h)
+
+        template <typename Visitor>
+        void Ecosystem::ForEachEntityInRect(float minX, float minY, float maxX, float maxY, Visitor &&visitor)
+        {
+            mEntityGrid.ForEachInRect(minX, minY, maxX, maxY, [this, &visitor](std::size_t item)
+                                      {
+                                          uint32_t index = mEntityRemap[item];
+                                          if (index != kNotIndexed)
+                                              visitor(static_cast<std::size_t>(index)); });
+            for (const EntityHandle &handle : mUnindexedEntities)
+            {
+                long index = mEntities.Find(handle);
+                if (index < 0)
+                    continue;
+                float x = mEntities.positionX[index];
+                float y = mEntities.positionY[index];
+                if (x >= minX && x <= maxX && y >= minY && y <= maxY)
+                    visitor(static_cast<std::size_t>(index));
+            }
+        }
+
+        template <typename Visitor>
+        void Ecosystem::ForEachFoodInRect(float minX, float minY, float maxX, float maxY, Visitor &&visitor)
+        {
+            mFoodGrid.ForEachInRect(minX, minY, maxX, maxY, [this, &visitor](std::size_t item)
+                                    {
+                                        uint32_t index = mFoodRemap[item];
+                                        if (index != kNotIndexed)
+                                            visitor(static_cast<std::size_t>(index)); });
+            for (std::size_t f = mUnindexedFoodBegin; f < mFoodSources.size(); ++f)
+            {
+                const Vector2D &position = mFoodSources[f].position;
+                if (position.x >= minX && position.x <= maxX && position.y >= minY && position.y <= maxY)
+                    visitor(f);
+            }
+        }
+
     } // namespace Core
 } // namespace Ecosystem
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 #include "Structs.h"
-#include <SDL3/SDL.h>
-#include <memory> // Pour std::unique_ptr
-#include <random> // Pour std::mt19937
+#include "EntityStore.h"
+#include "SpatialGrid.h"
+#include "Graphics/Renderer.h"
+#include <cstddef> // Pour std::size_t
+#include <string>
 #include <vector> // Pour std::vector
 
 namespace Ecosystem
@@ -10,80 +12,76 @@ namespace Ecosystem
     namespace Core
     {
 
-        // ÉNUMÉRATION DES TYPES D'ENTITÉS
-        enum class EntityType
-        {
-            HERBIVORE,
-            CARNIVORE,
-            PLANT
-        };
-
+        // 🔗 ENTITÉ = "POIGNÉE" VERS LE STOCKAGE
+        // Les données vivent dans EntityStore (tableaux contigus). Une Entity ne contient
+        // qu'un pointeur vers le stockage et un index : elle se copie gratuitement et
+        // garde l'interface historique (Eat, GetEnergy...). La mise à jour par tick est faite
+        // par plages entières (EntityKernel), par l'écosystème qui recueille aussi les morts.
         class Entity
         {
         private:
-            // DONNÉES PRIVÉES - État interne protégé
-            // Le "m" devant signifie "member" (convention du cours)
-            float mEnergy;
-            float mMaxEnergy;
-            int mAge;
-            int mMaxAge;
-            bool mIsAlive;
-            Vector2D mVelocity;
-            EntityType mType;
-
-            // Générateur aléatoire
-            // "mutable" permet de modifier cette variable même dans une fonction const
-            mutable std::mt19937 mRandomGenerator;
+            EntityStore *mStore;
+            std::size_t mIndex;
 
         public:
-            // DONNÉES PUBLIQUES - Accès direct sécurisé
-            // On laisse la position publique pour faciliter l'accès par le moteur graphique
-            Vector2D position;
-            Color color;
-            float size;
-            std::string name;
-
-            // CONSTRUCTEURS
-            Entity(EntityType type, Vector2D pos, std::string entityName = "Unnamed");
-            Entity(const Entity &other); // Constructeur de copie
-
-            // DESTRUCTEUR
-            ~Entity();
+            // CONSTRUCTEUR
+            Entity(EntityStore &store, std::size_t index) : mStore(&store), mIndex(index) {}
 
             // MÉTHODES PUBLIQUES
-            void Update(float deltaTime);
-            void Move(float deltaTime);
-            void Eat(float energy);
+            // Le recensement est mis à jour directement, ou via "ledger" dans une passe parallèle
+            void Eat(float energy, EnergyLedger *ledger = nullptr);
             bool CanReproduce() const;
 
-            // Retourne un pointeur unique vers le "bébé" (gestion mémoire automatique)
-            std::unique_ptr<Entity> Reproduce();
+            // Retourne vrai si un bébé doit naître (le parent paie le coût énergétique).
+            // C'est l'écosystème qui crée ensuite le bébé avec EntityStore::AddChild.
+            bool Reproduce();
+
+            // Les deux moitiés de Reproduce : la décision (sans rien modifier, utilisable
+            // en parallèle) puis le coût, payé seulement si la naissance est acceptée
+            bool WantsToReproduce() const;
+            void PayReproductionCost();
 
             void ApplyForce(Vector2D force);
 
-            // GETTERS - Accès contrôlé aux données privées
-            float GetEnergy() const { return mEnergy; }
-            float GetEnergyPercentage() const { return mEnergy / mMaxEnergy; }
-            int GetAge() const { return mAge; }
-            bool IsAlive() const { return mIsAlive; }
-            EntityType GetType() const { return mType; }
-            Vector2D GetVelocity() const { return mVelocity; }
+            // GETTERS - Accès contrôlé aux données du stockage
+            std::size_t GetIndex() const { return mIndex; }
+            float GetEnergy() const { return mStore->energy[mIndex]; }
+            float GetEnergyPercentage() const { return mStore->energy[mIndex] / mStore->maxEnergy[mIndex]; }
+            float GetAge() const { return mStore->age[mIndex]; }
+            bool IsAlive() const { return mStore->alive[mIndex] != 0; }
+            bool HasLowEnergy() const { return GetTintLevel() != 0; } // Dessinée en rouge
+            // Teinte par paliers : 0 = couleur de l'espèce, puis de 1 à kLowEnergyTints de plus en
+            // plus rouge sous kLowEnergyRatio. La couleur dessinée ne dépend que de ce palier : le
+            // décor immobile n'est à redessiner que quand il change (EntityStore::staticTint).
+            static constexpr float kLowEnergyRatio = 0.3f;
+            static constexpr uint8_t kLowEnergyTints = 8;
+            uint8_t GetTintLevel() const;
+            EntityType GetType() const { return mStore->type[mIndex]; }
+            Vector2D GetPosition() const { return Vector2D(mStore->positionX[mIndex], mStore->positionY[mIndex]); }
+            Vector2D GetVelocity() const { return Vector2D(mStore->velocityX[mIndex], mStore->velocityY[mIndex]); }
+            Color GetColor() const { return mStore->color[mIndex]; }
+            float GetSize() const { return mStore->size[mIndex]; }
+            std::string GetName() const { return mStore->FormatName(mIndex); } // Fabriqué à chaque appel
+
+            // Identité et lignée
+            uint64_t GetId() const { return mStore->id[mIndex]; }
+            uint64_t GetParentId() const { return mStore->parentId[mIndex]; } // EntityStore::kNoParent si apparue
+            uint32_t GetGeneration() const { return mStore->generation[mIndex]; }
 
             // MÉTHODES DE COMPORTEMENT (L'Intelligence Artificielle)
-            // Notez les < > que j'ai rajoutés ci-dessous :
-            Vector2D SeekFood(const std::vector<Food> &foodSources) const;
-            Vector2D AvoidPredators(const std::vector<Entity> &predators) const; // C'était incomplet
+            // Les voisins sont cherchés dans les grilles spatiales de l'écosystème :
+            // foodGrid indexe foodSources, entityGrid indexe le stockage des entités.
+            Vector2D SeekFood(const std::vector<Food> &foodSources, const SpatialGrid &foodGrid) const;
+            Vector2D SeekPrey(const SpatialGrid &entityGrid) const;
+            Vector2D AvoidPredators(const SpatialGrid &entityGrid) const;
             Vector2D StayInBounds(float worldWidth, float worldHeight) const;
 
             // MÉTHODE DE RENDU
-            void Render(SDL_Renderer *renderer) const;
+            // alpha (0..1) : position intermédiaire entre le tick précédent et le tick actuel
+            void Render(Graphics::Renderer &renderer, float alpha = 1.0f) const;
 
         private:
             // MÉTHODES PRIVÉES - Logique interne
-            void ConsumeEnergy(float deltaTime);
-            void Age(float deltaTime);
-            void CheckVitality();
-            Vector2D GenerateRandomDirection();
             Color CalculateColorBasedOnState() const;
         };
 
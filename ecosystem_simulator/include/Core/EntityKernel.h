@@ -0,0 +1,75 @@
+#pragma once
+#include "EntityStore.h"
+#include <cstddef> // Pour std::size_t
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🚀 NOYAU DE MISE À JOUR PAR LOTS
+        // Remplace l'ancien Entity::Update (ConsumeEnergy, Age, Move, CheckVitality appelés
+        // entité par entité, avec un switch sur le type) par une boucle sur une plage
+        // contiguë du stockage : 8 entités par instruction en AVX2, 4 en SSE2, une en scalaire.
+        //
+        // Les constantes qui dépendent de l'espèce (métabolisme, vitesse, coût du mouvement)
+        // sont lues dans la table des espèces du stockage (EntityStore::species), indexée
+        // par le type : une même plage peut mélanger les espèces, sans branche.
+        // Les morts sont détectées par un masque, sans branche par entité. L'écart d'énergie
+        // de chaque espèce est cumulé au passage (en entiers, voir EnergyLedger) pour tenir
+        // le recensement à jour sans parcourir la population une seconde fois.
+        // Les positions restent dans le monde (EntityStore::bounds) : rebond sur les murs ou
+        // passage de l'autre côté, selon la configuration.
+        //
+        // Les trois versions font exactement les mêmes opérations flottantes dans le même
+        // ordre (pas de FMA) : le résultat est identique au bit près sur toutes les machines,
+        // ce qui préserve la reproductibilité d'une graine.
+        class EntityKernel
+        {
+        public:
+            enum class InstructionSet
+            {
+                Scalar,
+                SSE2,
+                AVX2
+            };
+
+            // Bilan d'une plage : morts détectées et écart d'énergie par espèce
+            struct Summary
+            {
+                uint32_t hunger = 0;
+                uint32_t age = 0;
+                EnergyLedger energy; // À reporter dans EntityStore::census
+            };
+
+            // 🎲 CHANGEMENTS DE DIRECTION ALÉATOIRES (passe scalaire, avant Integrate)
+            // Le tirage est un hachage par entité : il ne se vectorise pas utilement.
+            static void ApplyWander(EntityStore &store, std::size_t begin, std::size_t end);
+
+            // Vitesse maximale, du même ordre que les directions aléatoires
+            static constexpr float kMaxSpeed = 1.5f;
+
+            // 🧭 INTÉGRATION DES FORCES DE PILOTAGE sur [begin, end)
+            // vitesse += force * gain, puis vitesse bornée à kMaxSpeed. forceX/forceY sont
+            // indexés à partir de begin ; les morts et les espèces immobiles sont ignorés.
+            static void ApplyForces(EntityStore &store, std::size_t begin, std::size_t end,
+                                    const float *forceX, const float *forceY, float gain);
+
+            // ⚙ MÉTABOLISME + VIEILLISSEMENT + MOUVEMENT + VITALITÉ sur [begin, end)
+            // Les index des entités mortes pendant ce pas sont ajoutés à "deaths".
+            // Chaque entité avance de EntityStore::updateSteps pas de deltaTime (0 = ignorée).
+            static Summary Integrate(EntityStore &store, std::size_t begin, std::size_t end,
+                                    float deltaTime, std::vector<std::size_t> &deaths);
+
+            // Jeu d'instructions choisi au démarrage selon le processeur
+            static InstructionSet GetInstructionSet();
+            static const char *GetInstructionSetName(InstructionSet instructionSet);
+
+            // Force un jeu d'instructions (tests de performance) ; ignoré s'il n'est pas disponible
+            static void SetInstructionSet(InstructionSet instructionSet);
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,202 @@
+#pragma once
+#include "Structs.h"
+#include "PopulationCensus.h"
+#include "Random.h"
+#include "Species.h"
+#include <cstddef> // Pour std::size_t
+#include <cstdint> // Pour uint8_t
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🔖 POIGNÉE STABLE VERS UNE ENTITÉ
+        // L'index dans les tableaux change quand les morts sont retirés ; la poignée, elle,
+        // désigne toujours la même entité. Quand une case est réutilisée par une autre
+        // entité, sa génération augmente : les anciennes poignées deviennent invalides
+        // au lieu de pointer silencieusement vers le nouvel occupant.
+        struct EntityHandle
+        {
+            uint32_t slot = 0;
+            uint32_t generation = 0; // 0 = poignée nulle (les générations commencent à 1)
+
+            bool operator==(const EntityHandle &other) const { return slot == other.slot && generation == other.generation; }
+            bool operator!=(const EntityHandle &other) const { return !(*this == other); }
+        };
+
+        // 🗃 STOCKAGE DES ENTITÉS EN "STRUCTURE OF ARRAYS"
+        // Au lieu d'un objet alloué par animal, chaque champ est rangé dans son propre
+        // tableau contigu : l'entité numéro i est la "colonne" i de tous les tableaux.
+        // Les boucles de simulation ne lisent ainsi que les champs dont elles ont besoin.
+        //
+        // Les tableaux fonctionnent comme un pool : ils ne rétrécissent jamais. Seules les
+        // Size() premières colonnes sont vivantes ; les suivantes gardent leur mémoire
+        // pour les prochaines naissances. Aucun champ n'alloue de mémoire par entité : les
+        // cycles d'explosion et d'effondrement de population ne sollicitent plus l'allocateur.
+        class EntityStore
+        {
+        public:
+            // DONNÉES CHAUDES - lues et écrites à chaque tick
+            std::vector<float> positionX;
+            std::vector<float> positionY;
+            std::vector<float> velocityX;
+            std::vector<float> velocityY;
+            std::vector<float> energy;
+            std::vector<float> age; // En float : un petit deltaTime doit quand même faire vieillir
+            std::vector<EntityType> type;
+            std::vector<uint8_t> alive; // uint8_t plutôt que bool (std::vector<bool> est compressé)
+            std::vector<uint64_t> id;   // Identifiant unique (clé des tirages aléatoires)
+            std::vector<uint32_t> slot; // Case de la table des poignées
+
+            // NIVEAU DE DÉTAIL (voir LodScheduler)
+            std::vector<uint8_t> updateSteps; // Ticks à intégrer pendant ce tick (0 = entité au repos)
+            std::vector<uint8_t> lodDebt;     // Ticks passés au repos depuis la dernière mise à jour
+
+            // Positions au tick précédent (interpolation du rendu entre deux ticks)
+            std::vector<float> previousPositionX;
+            std::vector<float> previousPositionY;
+
+            // DONNÉES FROIDES - rarement consultées (naissance, rendu, logs)
+            std::vector<float> maxEnergy;
+            std::vector<int> maxAge;
+            std::vector<Color> color;
+            static constexpr uint8_t kNotPainted = 0xFF;
+            std::vector<uint8_t> staticTint; // Teinte dessinée dans la couche statique (rendu), ou kNotPainted
+            std::vector<float> size;
+            std::vector<uint64_t> birthTick; // Tick de l'apparition ou de la naissance
+
+            // IDENTITÉ (des entiers : aucune chaîne allouée par naissance)
+            // Le nom lisible ("Herbivore_42") n'est fabriqué qu'à la demande (FormatName).
+            static constexpr uint64_t kNoParent = ~0ull;
+            std::vector<uint64_t> parentId;     // Identifiant du parent, ou kNoParent
+            std::vector<uint32_t> generation;   // 0 pour une apparition, parent + 1 pour un bébé
+            std::vector<uint32_t> label;        // Index dans la table des étiquettes (0 = nom de l'espèce)
+
+            // CONTEXTE DE SIMULATION
+            // Le hasard est un service partagé : un tirage dépend de (graine, id, tick, flux).
+            RandomService random;
+            uint64_t tick = 0;   // Tick en cours (mis à jour par l'écosystème)
+            uint64_t nextId = 0; // Prochain identifiant attribué
+            SpeciesTable species; // Caractéristiques de chaque espèce (copiées de la configuration)
+            WorldBounds bounds;   // Le noyau garde les positions dans [0, largeur] x [0, hauteur]
+
+            // Population, énergie et âges par espèce, suivis à chaque ajout, retrait ou
+            // changement d'énergie (voir PopulationCensus)
+            PopulationCensus census;
+
+            // Tirage pour l'entité "index" pendant le tick en cours
+            float RandomUnit(std::size_t index, RandomStream stream) const
+            {
+                return random.Uniform01(id[index], tick, stream);
+            }
+
+            // MÉTHODES PUBLIQUES
+            std::size_t Size() const { return mCount; }
+            void Reserve(std::size_t capacity);
+            void Clear();
+
+            // Remplace le contenu par "count" colonnes non initialisées, avec des poignées
+            // neuves (chargement d'une sauvegarde, qui remplit ensuite les tableaux
+            // puis appelle RebuildCensus)
+            void Resize(std::size_t count);
+
+            // 🔖 POIGNÉES
+            EntityHandle GetHandle(std::size_t index) const { return {slot[index], mSlotGeneration[slot[index]]}; }
+            bool IsValid(EntityHandle handle) const
+            {
+                return handle.slot < mSlotGeneration.size() && mSlotGeneration[handle.slot] == handle.generation;
+            }
+            // Index actuel de l'entité, ou -1 si elle n'existe plus
+            long Find(EntityHandle handle) const { return IsValid(handle) ? static_cast<long>(mSlotIndex[handle.slot]) : -1; }
+
+            // Ajoute une entité "neuve" et retourne son index
+            std::size_t Add(EntityType entityType, Vector2D position, uint32_t labelIndex = 0);
+
+            // Ajoute un bébé à partir de son parent (remplace l'ancien constructeur de copie)
+            std::size_t AddChild(std::size_t parentIndex);
+
+            // Change l'énergie d'une entité hors du noyau, recensement compris (un seul thread :
+            // les passes parallèles accumulent plutôt leurs écarts dans un EnergyLedger)
+            void SetEnergy(std::size_t index, float value)
+            {
+                census.OnEnergyChanged(type[index], energy[index], value);
+                energy[index] = value;
+            }
+
+            // 🏷 ÉTIQUETTES : les noms donnés à la main (AddEntity) sont rangés une seule fois
+            // dans une petite table ; l'entité n'en garde que l'index, transmis à ses bébés
+            uint32_t InternLabel(const std::string &text);
+            const std::vector<std::string> &GetLabels() const { return mLabels; }
+            void SetLabels(std::vector<std::string> labels); // Chargement d'une sauvegarde
+
+            // Nom lisible, fabriqué à la demande : "<étiquette ou espèce>_<id>"
+            std::string FormatName(std::size_t index) const;
+
+            // 🗂 COLONNES QUI DÉCRIVENT L'ÉTAT, dans l'ordre du fichier de sauvegarde : celles-ci
+            // sont sauvegardées et entrent dans l'empreinte (Ecosystem::ComputeStateHash). Les
+            // autres se reconstruisent (slot, updateSteps) ou ne servent qu'au rendu (staticTint).
+            // "Store" : EntityStore, const ou non.
+            template <typename Store, typename Function>
+            static void ForEachPersistentColumn(Store &store, Function function)
+            {
+                function(store.positionX);
+                function(store.positionY);
+                function(store.previousPositionX);
+                function(store.previousPositionY);
+                function(store.velocityX);
+                function(store.velocityY);
+                function(store.energy);
+                function(store.age);
+                function(store.type);
+                function(store.alive);
+                function(store.id);
+                function(store.maxEnergy);
+                function(store.maxAge);
+                function(store.color);
+                function(store.size);
+                function(store.birthTick);
+                function(store.parentId);
+                function(store.generation);
+                function(store.lodDebt);
+                function(store.label); // Toujours la dernière (vérifiée au chargement)
+            }
+
+            // Recompte tout depuis les tableaux (après le chargement d'une sauvegarde)
+            void RebuildCensus();
+
+            // Mémorise les positions actuelles avant un nouveau pas de simulation
+            void SavePreviousPositions();
+
+            // Supprime les entités dont les index sont donnés ("échange et retrait") :
+            // chaque mort est remplacé par la dernière colonne. Le coût dépend du nombre de
+            // morts, pas de la population ; l'ordre n'est pas conservé, mais les poignées
+            // (GetHandle / Find) continuent de désigner les mêmes entités.
+            // La liste est triée sur place, du plus grand index au plus petit, ordre dans lequel
+            // les morts sont remplacés. Retourne le nombre d'entités supprimées.
+            std::size_t RemoveDead(std::vector<std::size_t> &deadIndices);
+
+        private:
+            std::size_t mCount = 0; // Colonnes vivantes (les tableaux peuvent être plus longs)
+
+            // TABLE DES POIGNÉES (case → index dans les tableaux)
+            std::vector<uint32_t> mSlotIndex;
+            std::vector<uint32_t> mSlotGeneration;
+            std::vector<uint32_t> mFreeSlots; // Cases libérées, réutilisées en priorité
+
+            // Table des étiquettes (l'index 0, vide, désigne le nom de l'espèce)
+            std::vector<std::string> mLabels = {std::string()};
+            std::unordered_map<std::string, uint32_t> mLabelIndex = {{std::string(), 0}};
+
+            std::size_t Append();
+            void AcquireSlot(std::size_t index);
+            void ReleaseSlot(std::size_t index);
+            void MoveEntry(std::size_t from, std::size_t to);
+            void Grow(std::size_t count);
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -1,6 +1,11 @@
 #pragma once
 #include "Graphics/Window.h"
+#include "Graphics/Camera.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/StaticLayer.h"
 #include "Ecosystem.h"
+#include "ReplayLog.h"
+#include "StatisticsWriter.h"
 #include <chrono>     // Pour le chronomètre
 #include <string>     // Pour std::string
 #include <SDL3/SDL.h> // Pour SDL_Keycode
@@ -15,6 +20,9 @@ namespace Ecosystem
         private:
             // ÉTAT DU MOTEUR
             Graphics::Window mWindow;
+            Graphics::Renderer mRenderer; // Lot de rectangles envoyé à SDL une fois par image
+            Graphics::StaticLayer mStaticLayer; // Décor immobile (nourriture, plantes) mis en cache
+            Graphics::Camera mCamera;           // Partie du monde affichée dans la fenêtre
             Ecosystem mEcosystem;
             bool mIsRunning;
             bool mIsPaused;
@@ -23,17 +31,54 @@ namespace Ecosystem
             // ⏱ CHRONOMÉTRE
             // time_point stocke un instant précis dans le temps
             std::chrono::high_resolution_clock::time_point mLastUpdateTime;
+
+            // PAS DE TEMPS FIXE
+            // Le temps réel (multiplié par mTimeScale) s'accumule dans mAccumulatedTime,
+            // puis la simulation avance par pas identiques de 1 / mSimulationRate secondes.
+            // Accélérer le temps = plus de pas par image, jamais des pas plus grands.
             float mAccumulatedTime;
+            float mSimulationRate;  // Pas de simulation par seconde simulée
+            int mMaxStepsPerFrame;  // Limite de rattrapage (évite la "spirale de la mort")
+
+            // 📒 PROFILEUR À L'ÉCRAN (touche P)
+            bool mShowProfiler; // Masqué au départ
+            float mLastRenderMs; // Durée du dernier rendu, enregistrée avec l'image
+
+            // 💾 SAUVEGARDE (F5 écrit, F9 recharge)
+            std::string mSnapshotPath;
+
+            // 🎬 JOURNAL DE REJEU (--record)
+            ReplayLog mReplay;
+
+            // 📈 STATISTIQUES (--stats-file) ; résumé dans la console toutes les 2 s simulées
+            StatisticsWriter mStatsWriter;
 
         public:
             // 🏗 CONSTRUCTEUR
-            GameEngine(const std::string &title, float width, float height);
+            // Fenêtre de config.GetWindowWidth() x config.GetWindowHeight() ; au départ, la
+            // caméra montre tout le monde
+            GameEngine(const std::string &title, const WorldConfig &config);
 
             // ⚙ MÉTHODES PRINCIPALES
             bool Initialize();
             void Run();
             void Shutdown();
 
+            // ⏱ RÉGLAGES DE LA BOUCLE
+            void SetSimulationRate(float stepsPerSecond);
+            void SetMaxStepsPerFrame(int maxSteps);
+            void SetSeed(uint64_t seed) { mEcosystem.SetSeed(seed); }
+
+            // 💾 Fichier utilisé par F5/F9 ; LoadSnapshot remplace la population de départ
+            void SetSnapshotPath(const std::string &path) { mSnapshotPath = path; }
+            bool LoadSnapshot(const std::string &path);
+
+            // 🔴 Journalise les ticks et les commandes à partir de maintenant
+            bool StartRecording(const std::string &path) { return mReplay.Open(path, mEcosystem, 1.0f / mSimulationRate); }
+
+            // 📈 Écrit la série des statistiques, tick par tick, dans un fichier en colonnes
+            bool OpenStatisticsFile(const std::string &path) { return mStatsWriter.Open(path); }
+
             // 🎮 GESTION D'ÉVÉNEMENTS
             void HandleEvents();
             void HandleInput(SDL_Keycode key);
@@ -41,8 +86,9 @@ namespace Ecosystem
         private:
             // MÉTHODES INTERNES
             void Update(float deltaTime);
-            void Render();
+            void Render(float alpha);
             void RenderUI();
+            void RenderProfilerGraph();
         };
 
     } // namespace Core
@@ -0,0 +1,65 @@
+#pragma once
+#include "Ecosystem.h"
+#include <cstdint>
+#include <string>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🖥 SIMULATION SANS FENÊTRE
+        // Fait avancer l'écosystème à pas de temps fixe, aussi vite que le processeur
+        // le permet (pas de SDL, pas de rendu, pas de pause entre deux ticks).
+        // Utilisé pour les campagnes de paramètres sur des serveurs sans écran.
+        class HeadlessRunner
+        {
+        public:
+            struct Options
+            {
+                int64_t maxTicks = 10000;       // 0 = jusqu'à l'extinction
+                float timeStep = 1.0f / 60.0f;  // Pas de temps fixe (secondes simulées)
+                bool stopOnExtinction = true;   // Arrêt quand il n'y a plus d'animaux
+                std::string profileCsvPath;     // Si non vide : durée de chaque phase, tick par tick
+                std::string snapshotPath;       // Si non vide : sauvegarde écrite à la fin de l'exécution
+                int64_t snapshotInterval = 0;   // Et tous les N ticks si N > 0 (points de reprise)
+                std::string recordPath;         // Si non vide : journal de rejeu (empreinte de chaque tick)
+                std::string statsPath;          // Si non vide : statistiques de chaque tick, en colonnes
+            };
+
+            // Résultat d'une exécution (pour affichage ou exploitation par un script)
+            struct Report
+            {
+                int64_t ticks = 0;
+                int64_t entityUpdates = 0; // Somme des populations sur tous les ticks
+                double seconds = 0.0;
+                bool extinct = false;
+                bool failed = false; // Un fichier de sortie n'a pas pu être ouvert : rien n'a été simulé
+            };
+
+        private:
+            Ecosystem mEcosystem;
+
+        public:
+            // 🏗 CONSTRUCTEUR
+            explicit HeadlessRunner(const WorldConfig &config);
+            HeadlessRunner(float width, float height, int maxEntities = 500);
+
+            // ⚙ MÉTHODES PRINCIPALES
+            void Initialize(int initialHerbivores, int initialCarnivores, int initialPlants);
+            void Initialize(); // Population de départ de la configuration
+            bool LoadSnapshot(const std::string &path); // Reprise d'une sauvegarde (après Initialize)
+            Report Run(const Options &options);
+
+            // Affiche le débit (ticks/s, mises à jour d'entités/s)
+            static void PrintReport(const Report &report);
+
+            // GETTERS
+            Ecosystem &GetEcosystem() { return mEcosystem; }
+
+            // 🎲 Graine du monde (avant Initialize)
+            void SetSeed(uint64_t seed) { mEcosystem.SetSeed(seed); }
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef> // Pour std::size_t
+#include <deque>
+#include <functional>
+#include <memory> // Pour std::unique_ptr
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🧵 SYSTÈME DE TÂCHES (pool de threads à "vol de travail")
+        // Un nombre fixe de threads est créé une seule fois (un par cœur). Chaque thread
+        // possède sa propre file de tâches ; quand elle est vide, il "vole" des tâches
+        // dans la file des autres. Le thread appelant participe aussi au travail.
+        //
+        // ParallelFor découpe un intervalle en blocs ("chunks") de taille fixe. Le découpage
+        // ne dépend que du nombre d'éléments, jamais du nombre de threads : un résultat
+        // rangé par numéro de bloc est donc identique quelle que soit la machine.
+        class JobSystem
+        {
+        public:
+            // job(numéroDeBloc, début, fin) traite les éléments [début, fin)
+            using ChunkJob = std::function<void(std::size_t chunk, std::size_t begin, std::size_t end)>;
+
+            // CONSTRUCTEUR/DESTRUCTEUR
+            // workerCount = 0 : autant de threads que de cœurs matériels
+            explicit JobSystem(unsigned workerCount = 0);
+            ~JobSystem();
+
+            JobSystem(const JobSystem &) = delete;
+            JobSystem &operator=(const JobSystem &) = delete;
+
+            // Exécute job sur tous les blocs et attend la fin de tous (barrière)
+            void ParallelFor(std::size_t count, std::size_t chunkSize, const ChunkJob &job);
+
+            // Nombre de blocs produits par ParallelFor pour ces paramètres
+            static std::size_t ChunkCount(std::size_t count, std::size_t chunkSize);
+
+            // Nombre de threads qui travaillent (threads du pool + thread appelant)
+            unsigned GetThreadCount() const { return static_cast<unsigned>(mThreads.size()) + 1; }
+
+        private:
+            struct Task
+            {
+                const ChunkJob *job;
+                std::size_t chunk;
+                std::size_t begin;
+                std::size_t end;
+            };
+
+            struct WorkQueue
+            {
+                std::mutex mutex;
+                std::deque<Task> tasks;
+            };
+
+            // File 0 = thread appelant, files 1..N = threads du pool
+            std::vector<std::unique_ptr<WorkQueue>> mQueues;
+            std::vector<std::thread> mThreads;
+
+            std::mutex mWakeMutex;
+            std::condition_variable mWakeCondition; // Réveille les threads quand du travail arrive
+            std::condition_variable mDoneCondition; // Réveille l'appelant quand tout est fini
+            std::atomic<std::size_t> mQueuedTasks;  // Tâches en file, pas encore prises
+            std::atomic<std::size_t> mRemainingTasks; // Tâches pas encore terminées
+            bool mStopping;
+
+            void WorkerLoop(std::size_t queueIndex);
+            bool TryPop(std::size_t queueIndex, Task &task);
+            bool TrySteal(std::size_t queueIndex, Task &task);
+            void Execute(const Task &task);
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
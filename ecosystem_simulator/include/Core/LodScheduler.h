@@ -0,0 +1,64 @@
+#pragma once
+#include "EntityStore.h"
+#include "SpatialGrid.h"
+#include <cstddef> // Pour std::size_t
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🔭 NIVEAU DE DÉTAIL DE LA SIMULATION
+        // Une région (cellule de la grille des entités) est "active" si une entité mobile s'y
+        // trouve ou dans une cellule voisine. Là, tout est mis à jour à chaque tick. Ailleurs,
+        // les entités immobiles (les plantes) ne sont mises à jour qu'un tick sur "interval",
+        // avec le temps écoulé cumulé : même métabolisme, même vieillissement, même chance
+        // de reproduction en moyenne, pour une fraction du travail.
+        //
+        // Le tick de mise à jour d'une entité au repos dépend de son identifiant : les
+        // plantes d'une région sont réparties sur les "interval" ticks, pas toutes ensemble.
+        // La carte des régions actives est refaite au début de chaque tick, d'après l'état
+        // sauvegardé : une simulation rechargée garde exactement le même calendrier.
+        class LodScheduler
+        {
+        public:
+            static const int kMaxInterval = 64; // Doit tenir dans EntityStore::lodDebt
+
+            // Puissance de 2 entre 1 et kMaxInterval (1 : tout est mis à jour à chaque tick)
+            static bool IsValidInterval(int interval)
+            {
+                return interval >= 1 && interval <= kMaxInterval && (interval & (interval - 1)) == 0;
+            }
+
+            // Chance qu'au moins un de "steps" tirages de probabilité "chance" réussisse
+            // (par multiplications successives : même résultat sur toutes les machines)
+            static float CombinedChance(float chance, uint8_t steps)
+            {
+                float miss = 1.0f;
+                for (uint8_t s = 0; s < steps; ++s)
+                    miss *= 1.0f - chance;
+                return 1.0f - miss;
+            }
+
+            explicit LodScheduler(int interval = 1) : mInterval(interval) {}
+
+            int GetInterval() const { return mInterval; }
+
+            // 🗺 Régions actives d'après la position des entités mobiles ("grid" ne sert que
+            // pour son découpage en cellules : elle n'a pas besoin d'être à jour)
+            void MarkActivity(const EntityStore &store, const SpatialGrid &grid);
+
+            // 📅 Remplit EntityStore::updateSteps sur [begin, end) pour le tick store.tick :
+            // 0 pour une entité laissée au repos, sinon le nombre de ticks à intégrer.
+            // "grid" est celle qui a servi à MarkActivity (même découpage en régions).
+            void Schedule(EntityStore &store, const SpatialGrid &grid, std::size_t begin, std::size_t end) const;
+
+        private:
+            int mInterval;
+            std::vector<uint8_t> mActive; // Une case par cellule de la grille
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
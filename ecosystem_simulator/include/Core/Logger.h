@@ -0,0 +1,134 @@
+#pragma once
+#include <atomic>
+#include <cstddef> // Pour std::size_t
+#include <cstdint>
+#include <memory> // Pour std::unique_ptr
+#include <thread>
+
+// 🔇 NIVEAU MINIMAL COMPILÉ
+// Les messages en dessous de ce niveau disparaissent complètement du binaire.
+// 0 = Trace, 1 = Debug, 2 = Info, 3 = Warning, 4 = Error, 5 = Off
+// Ex. : -DECOSYSTEM_LOG_COMPILE_LEVEL=0 pour garder les événements par entité.
+#ifndef ECOSYSTEM_LOG_COMPILE_LEVEL
+#define ECOSYSTEM_LOG_COMPILE_LEVEL 1
+#endif
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // NIVEAUX DE JOURNALISATION
+        enum class LogLevel : int
+        {
+            Trace = 0, // Événements par entité (naissance, repas, mort...)
+            Debug = 1,
+            Info = 2,
+            Warning = 3,
+            Error = 4,
+            Off = 5
+        };
+
+        // ÉVÉNEMENTS DU CYCLE DE VIE (comptés, jamais affichés par défaut)
+        enum class LifecycleEvent : int
+        {
+            Created,      // Entité créée par l'écosystème
+            Born,         // Bébé issu d'une reproduction
+            Meal,         // Repas d'un herbivore ou d'un carnivore
+            DiedOfHunger, // Énergie tombée à zéro
+            DiedOfAge,    // Âge maximal atteint
+            Preyed,       // Dévoré par un carnivore
+            Grazed,       // Plante broutée jusqu'à la dernière bouchée
+            Count
+        };
+
+        // 📝 JOURNAL ASYNCHRONE
+        // Les threads de simulation ne font jamais d'entrée/sortie : ils formatent leur
+        // message directement dans une case d'un tampon circulaire sans verrou, puis
+        // repartent. Un thread d'arrière-plan vide le tampon vers stdout/stderr par paquets.
+        // Si le tampon est plein, le message est abandonné (et compté) plutôt que d'attendre.
+        class Logger
+        {
+        public:
+            static Logger &Instance();
+
+            // ⚙ FILTRAGE À L'EXÉCUTION
+            void SetLevel(LogLevel level) { mLevel.store(static_cast<int>(level), std::memory_order_relaxed); }
+            LogLevel GetLevel() const { return static_cast<LogLevel>(mLevel.load(std::memory_order_relaxed)); }
+            bool IsEnabled(LogLevel level) const { return static_cast<int>(level) >= mLevel.load(std::memory_order_relaxed); }
+
+            // ✍ ÉCRITURE (format printf), appelable depuis n'importe quel thread
+            void Write(LogLevel level, const char *format, ...)
+#if defined(__GNUC__) || defined(__clang__)
+                __attribute__((format(printf, 3, 4)))
+#endif
+                ;
+
+            // Attend que tous les messages déjà écrits soient affichés
+            void Flush();
+
+            // 🔢 COMPTEURS D'ÉVÉNEMENTS
+            void CountEvent(LifecycleEvent event, uint64_t amount = 1)
+            {
+                mEventCounts[static_cast<int>(event)].fetch_add(amount, std::memory_order_relaxed);
+            }
+            uint64_t GetEventCount(LifecycleEvent event) const
+            {
+                return mEventCounts[static_cast<int>(event)].load(std::memory_order_relaxed);
+            }
+            uint64_t GetDroppedCount() const { return mDropped.load(std::memory_order_relaxed); }
+
+            // Convertit "trace", "info"... en niveau ; retourne false si le nom est inconnu
+            static bool ParseLevel(const char *name, LogLevel &level);
+
+        private:
+            static const std::size_t kCapacity = 4096;   // Nombre de cases (puissance de 2)
+            static const std::size_t kMessageSize = 240; // Taille maximale d'un message
+
+            struct Slot
+            {
+                std::atomic<std::size_t> sequence;
+                LogLevel level;
+                char text[kMessageSize];
+            };
+
+            std::unique_ptr<Slot[]> mSlots;
+            std::atomic<std::size_t> mEnqueuePosition; // Partagé par tous les producteurs
+            std::size_t mDequeuePosition;              // Réservé au thread d'écriture
+            std::atomic<std::size_t> mWrittenCount;    // Messages réellement affichés
+
+            std::atomic<int> mLevel;
+            std::atomic<uint64_t> mDropped;
+            std::atomic<uint64_t> mEventCounts[static_cast<int>(LifecycleEvent::Count)];
+
+            std::atomic<bool> mStopping;
+            std::thread mWriterThread;
+
+            Logger();
+            ~Logger();
+            Logger(const Logger &) = delete;
+            Logger &operator=(const Logger &) = delete;
+
+            void WriterLoop();
+            std::size_t Drain();
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
+
+// 📣 MACROS DE JOURNALISATION
+// Le test du niveau compilé est une constante : en dessous, l'appel est éliminé par le
+// compilateur et ses arguments ne sont même pas évalués.
+#define ECO_LOG(level, ...)                                                             \
+    do                                                                                  \
+    {                                                                                   \
+        if (static_cast<int>(level) >= ECOSYSTEM_LOG_COMPILE_LEVEL &&                   \
+            ::Ecosystem::Core::Logger::Instance().IsEnabled(level))                     \
+            ::Ecosystem::Core::Logger::Instance().Write(level, __VA_ARGS__);            \
+    } while (0)
+
+#define ECO_LOG_TRACE(...) ECO_LOG(::Ecosystem::Core::LogLevel::Trace, __VA_ARGS__)
+#define ECO_LOG_DEBUG(...) ECO_LOG(::Ecosystem::Core::LogLevel::Debug, __VA_ARGS__)
+#define ECO_LOG_INFO(...) ECO_LOG(::Ecosystem::Core::LogLevel::Info, __VA_ARGS__)
+#define ECO_LOG_WARNING(...) ECO_LOG(::Ecosystem::Core::LogLevel::Warning, __VA_ARGS__)
+#define ECO_LOG_ERROR(...) ECO_LOG(::Ecosystem::Core::LogLevel::Error, __VA_ARGS__)
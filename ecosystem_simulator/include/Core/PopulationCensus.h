@@ -0,0 +1,100 @@
+#pragma once
+#include "Species.h"
+#include <cmath>   // Pour std::lrint
+#include <cstddef> // Pour std::size_t
+#include <cstdint>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 💰 ÉCARTS D'ÉNERGIE ACCUMULÉS PAR UN BLOC DE TRAVAIL
+        // L'énergie est comptée en entiers (1/kEnergyScale) : une somme d'entiers ne dépend
+        // ni de l'ordre des ajouts, ni du nombre de threads, ni du jeu d'instructions.
+        struct EnergyLedger
+        {
+            static constexpr float kEnergyScale = 1024.0f;
+
+            int64_t delta[kSpeciesCount] = {};
+
+            static int64_t Quantize(float energy) { return std::lrint(energy * kEnergyScale); }
+
+            void Record(EntityType type, float before, float after)
+            {
+                delta[static_cast<std::size_t>(type)] += Quantize(after) - Quantize(before);
+            }
+        };
+
+        // 📊 RECENSEMENT TENU À JOUR PAR ÉVÉNEMENTS
+        // Population, énergie totale et pyramide des âges de chaque espèce, modifiées à
+        // chaque apparition, naissance, mort, repas et pas du noyau : les lire ne coûte
+        // rien, à n'importe quel moment du tick. Une entité est comptée tant qu'elle est
+        // dans le stockage (une proie tuée l'est encore jusqu'au retrait des morts).
+        //
+        // L'âge est compté en ticks depuis la naissance, par classes de kAgeBucketTicks.
+        // Tout le monde vieillit au même rythme : plutôt que de déplacer chaque entité d'une
+        // classe à l'autre, on compte les naissances par classe de date et c'est le
+        // "présent" qui avance. Les kAgeBuckets - 1 classes récentes forment un anneau ;
+        // quand une classe devient trop vieille, elle rejoint la dernière (les plus âgés).
+        class PopulationCensus
+        {
+        public:
+            static const uint64_t kAgeBucketTicks = 60; // 1 s à 60 ticks par seconde
+            static const std::size_t kAgeBuckets = 32;  // La dernière regroupe tous les plus âgés
+            static constexpr float kMaxEnergy = 1.0e6f; // Au-delà, le compte entier déborderait
+
+            PopulationCensus() { Reset(0); }
+
+            // Recensement vide, "présent" au tick donné
+            void Reset(uint64_t tick);
+
+            // Le présent avance (à appeler au début de chaque tick ; jamais en arrière)
+            void Advance(uint64_t tick);
+
+            void OnAdded(EntityType type, float energy, uint64_t birthTick);
+            void OnRemoved(EntityType type, float energy, uint64_t birthTick);
+
+            void OnEnergyChanged(EntityType type, float before, float after)
+            {
+                mEnergy[static_cast<std::size_t>(type)] += EnergyLedger::Quantize(after) - EnergyLedger::Quantize(before);
+            }
+            void Apply(const EnergyLedger &ledger)
+            {
+                for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                    mEnergy[t] += ledger.delta[t];
+            }
+
+            // 🔍 LECTURE (O(1), sauf GetAgeBucket : O(1) aussi, une case de l'anneau)
+            uint32_t GetPopulation(EntityType type) const { return mPopulation[static_cast<std::size_t>(type)]; }
+            uint32_t GetTotalPopulation() const;
+            double GetTotalEnergy(EntityType type) const
+            {
+                return static_cast<double>(mEnergy[static_cast<std::size_t>(type)]) / EnergyLedger::kEnergyScale;
+            }
+            double GetMeanEnergy(EntityType type) const
+            {
+                uint32_t population = GetPopulation(type);
+                return population > 0 ? GetTotalEnergy(type) / population : 0.0;
+            }
+
+            // Entités de l'espèce âgées de [bucket, bucket + 1) * kAgeBucketTicks ticks
+            // (bucket = kAgeBuckets - 1 : cet âge ou plus)
+            uint32_t GetAgeBucket(EntityType type, std::size_t bucket) const;
+
+        private:
+            static const std::size_t kRecentBuckets = kAgeBuckets - 1;
+
+            uint32_t mPopulation[kSpeciesCount];
+            int64_t mEnergy[kSpeciesCount]; // En 1/kEnergyScale
+
+            uint64_t mCurrentBucket;                           // Classe de date du présent
+            uint32_t mRecent[kSpeciesCount][kRecentBuckets];    // Indexé par classe de naissance % kRecentBuckets
+            uint32_t mOlder[kSpeciesCount];                     // Nés il y a kRecentBuckets classes ou plus
+
+            // Case où est comptée une entité née dans la classe "birthBucket"
+            uint32_t &BucketFor(std::size_t type, uint64_t birthBucket);
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,132 @@
+#pragma once
+#include "Structs.h"
+#include <array>
+#include <chrono>
+#include <cstddef> // Pour std::size_t
+#include <cstdint>
+#include <cstdio> // Pour std::FILE
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // ⏱ PHASES D'UN TICK (dans l'ordre d'Ecosystem::Update)
+        enum class ProfilePhase : uint8_t
+        {
+            Movement,     // Positions précédentes + mise à jour des entités
+            SpatialIndex, // Reconstruction des grilles
+            Steering,     // Recherche de nourriture, fuite
+            Eating,
+            Reproduction,
+            Culling,      // Retrait des morts
+            PlantGrowth,
+            Statistics,
+            Count
+        };
+
+        // 📒 PROFILEUR PAR PHASE
+        // Chaque tick écrit une ligne dans un anneau de taille fixe (aucune allocation
+        // pendant la simulation) : durée de chaque phase, population et nombre
+        // d'allocations. Les images (rendu) ont leur propre anneau, car il peut y avoir
+        // plusieurs ticks par image, ou aucun.
+        class Profiler
+        {
+        public:
+            static const std::size_t kPhaseCount = static_cast<std::size_t>(ProfilePhase::Count);
+            static const std::size_t kCapacity = 512; // Ticks (et images) conservés
+
+            struct TickRecord
+            {
+                uint64_t tick = 0;
+                uint32_t entities = 0;    // Population en fin de tick
+                uint32_t food = 0;
+                uint64_t allocations = 0; // Allocations pendant le tick
+                std::array<float, kPhaseCount> phaseMs{};
+                float totalMs = 0.0f;
+            };
+
+            struct FrameRecord
+            {
+                float frameMs = 0.0f;  // Image complète (événements + ticks + rendu)
+                float renderMs = 0.0f; // Construction du lot + envoi à SDL
+                uint32_t ticks = 0;    // Ticks de simulation joués pendant l'image
+            };
+
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            std::vector<TickRecord> mTicks;   // Anneau de kCapacity ticks
+            std::vector<FrameRecord> mFrames; // Anneau de kCapacity images
+            uint64_t mTickCount;              // Nombre total de ticks enregistrés
+            uint64_t mFrameCount;
+
+            TickRecord mCurrent; // Tick en cours de mesure
+            Clock::time_point mTickStart;
+            uint64_t mAllocationsAtStart;
+            bool mEnabled;
+
+        public:
+            // 🏗 CONSTRUCTEUR
+            Profiler();
+
+            void SetEnabled(bool enabled) { mEnabled = enabled; }
+            bool IsEnabled() const { return mEnabled; }
+
+            // ✍ ENREGISTREMENT D'UN TICK
+            void BeginTick(uint64_t tick);
+            void AddPhase(ProfilePhase phase, float milliseconds) { mCurrent.phaseMs[static_cast<std::size_t>(phase)] += milliseconds; }
+            void EndTick(std::size_t entities, std::size_t food);
+
+            // ✍ ENREGISTREMENT D'UNE IMAGE
+            void RecordFrame(float frameMs, float renderMs, uint32_t ticks);
+
+            // 🔍 LECTURE (age 0 = le plus récent ; age < GetTickCount())
+            std::size_t GetTickCount() const { return static_cast<std::size_t>(mTickCount < kCapacity ? mTickCount : kCapacity); }
+            std::size_t GetFrameCount() const { return static_cast<std::size_t>(mFrameCount < kCapacity ? mFrameCount : kCapacity); }
+            const TickRecord &GetTick(std::size_t age) const { return mTicks[(mTickCount - 1 - age) % kCapacity]; }
+            const FrameRecord &GetFrame(std::size_t age) const { return mFrames[(mFrameCount - 1 - age) % kCapacity]; }
+
+            // 📄 EXPORT CSV
+            // Écrit les ticks encore dans l'anneau à partir du numéro "nextTick", puis avance
+            // "nextTick". Appelé régulièrement, il produit un fichier continu.
+            static void WriteCsvHeader(std::FILE *file);
+            std::size_t WriteCsv(std::FILE *file, uint64_t &nextTick) const;
+
+            // 🎨 NOMS ET COULEURS DES PHASES (légende, graphique)
+            static const char *GetPhaseName(ProfilePhase phase);
+            static Color GetPhaseColor(ProfilePhase phase);
+
+            // Millisecondes écoulées depuis "start"
+            static float ElapsedMs(Clock::time_point start)
+            {
+                return std::chrono::duration<float, std::milli>(Clock::now() - start).count();
+            }
+            static Clock::time_point Now() { return Clock::now(); }
+        };
+
+        // ⏲ CHRONOMÈTRE DE PORTÉE
+        // Mesure la durée du bloc où il est déclaré et l'ajoute à la phase du tick en cours.
+        class ScopedTimer
+        {
+        private:
+            Profiler &mProfiler;
+            ProfilePhase mPhase;
+            std::chrono::steady_clock::time_point mStart;
+
+        public:
+            ScopedTimer(Profiler &profiler, ProfilePhase phase)
+                : mProfiler(profiler), mPhase(phase), mStart(Profiler::Now()) {}
+            ~ScopedTimer()
+            {
+                if (mProfiler.IsEnabled())
+                    mProfiler.AddPhase(mPhase, Profiler::ElapsedMs(mStart));
+            }
+
+            ScopedTimer(const ScopedTimer &) = delete;
+            ScopedTimer &operator=(const ScopedTimer &) = delete;
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
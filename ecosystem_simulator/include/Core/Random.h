@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🎲 FLUX DE TIRAGES
+        // Chaque usage du hasard a son propre numéro : deux tirages différents d'une même
+        // entité pendant un même tick ne retombent jamais sur le même nombre.
+        enum class RandomStream : uint32_t
+        {
+            WanderChance,       // Changement de direction occasionnel
+            DirectionX,         // Nouvelle direction aléatoire
+            DirectionY,
+            ReproductionChance, // Tirage de la reproduction
+            SpawnX,             // Position d'apparition (monde)
+            SpawnY,
+            PlantGrowth         // Pousse spontanée d'une plante (monde)
+        };
+
+        // 🔑 GÉNÉRATEUR "À COMPTEUR"
+        // Il n'y a aucun état qui avance : un nombre aléatoire est un hachage de
+        // (graine du monde, clé, tick, flux). La clé est l'identifiant de l'entité, ou
+        // kWorldKey pour les tirages de l'écosystème lui-même.
+        // Conséquences :
+        //  - aucune mémoire par entité (l'ancien std::mt19937 pesait ~5 Ko) ;
+        //  - une naissance ne coûte rien (pas de std::random_device) ;
+        //  - le résultat ne dépend pas de l'ordre des appels, donc ni du nombre de
+        //    threads : la même graine rejoue la même simulation au bit près.
+        class RandomService
+        {
+        private:
+            uint64_t mWorldSeed;
+
+        public:
+            static constexpr uint64_t kWorldKey = ~0ull;
+
+            // CONSTRUCTEUR
+            explicit RandomService(uint64_t worldSeed = 0) : mWorldSeed(worldSeed) {}
+
+            void SetSeed(uint64_t worldSeed) { mWorldSeed = worldSeed; }
+            uint64_t GetSeed() const { return mWorldSeed; }
+
+            // Mélangeur SplitMix64 : petites différences en entrée → sortie sans rapport
+            static uint64_t Mix(uint64_t value)
+            {
+                value += 0x9E3779B97F4A7C15ull;
+                value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+                value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+                return value ^ (value >> 31);
+            }
+
+            // 64 bits aléatoires pour (clé, tick, flux)
+            uint64_t Bits(uint64_t key, uint64_t tick, RandomStream stream) const
+            {
+                uint64_t hash = Mix(mWorldSeed ^ Mix(key));
+                hash = Mix(hash ^ tick);
+                return Mix(hash ^ static_cast<uint64_t>(stream));
+            }
+
+            // Réel uniforme dans [0, 1) (24 bits de mantisse, comme un float)
+            float Uniform01(uint64_t key, uint64_t tick, RandomStream stream) const
+            {
+                return static_cast<float>(Bits(key, tick, stream) >> 40) * (1.0f / 16777216.0f);
+            }
+
+            // Réel uniforme dans [min, max)
+            float Uniform(uint64_t key, uint64_t tick, RandomStream stream, float min, float max) const
+            {
+                return min + (max - min) * Uniform01(key, tick, stream);
+            }
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        class Ecosystem;
+
+        // 🎬 JOURNAL DE REJEU
+        // Avec une graine fixée, la simulation est entièrement déterministe (même résultat
+        // quel que soit le nombre de threads). Le journal enregistre donc seulement :
+        //  - l'en-tête : graine, pas de temps, empreinte de l'état de départ ;
+        //  - les commandes du joueur qui modifient le monde (R, F, F9), avec leur tick ;
+        //  - pour chaque tick : naissances, morts, repas, population et empreinte de l'état.
+        // Environ 40 octets par tick. Le rejeu refait la simulation depuis le même départ,
+        // réapplique les commandes et s'arrête au premier tick dont l'empreinte diffère.
+        class ReplayLog
+        {
+        public:
+            static constexpr uint32_t kVersion = 2; // 2 : l'empreinte couvre toutes les colonnes sauvegardées
+
+            // Commandes du joueur qui modifient le monde
+            enum class Command : uint8_t
+            {
+                Reset,        // R : population de départ de la configuration
+                SpawnFood,    // F : "argument" nourritures
+                LoadSnapshot  // F9 : le contenu du fichier n'est pas journalisé, le rejeu s'arrête là
+            };
+
+            // Résultat d'un rejeu
+            struct Result
+            {
+                bool ok = false;             // Toutes les empreintes correspondent
+                bool incomplete = false;     // Arrêt sur une commande non rejouable (F9)
+                int64_t ticks = 0;           // Ticks rejoués et vérifiés
+                int64_t divergentTick = -1;  // Premier tick qui diverge (-1 = aucun, -2 = état de départ)
+                uint64_t expectedHash = 0;
+                uint64_t actualHash = 0;
+                std::string error;           // Journal illisible, incompatible...
+            };
+
+            ReplayLog() = default;
+            ~ReplayLog();
+            ReplayLog(const ReplayLog &) = delete;
+            ReplayLog &operator=(const ReplayLog &) = delete;
+
+            // 🔴 ENREGISTREMENT (à ouvrir une fois l'état de départ en place)
+            bool Open(const std::string &path, const Ecosystem &ecosystem, float timeStep);
+            void Close();
+            bool IsRecording() const { return mFile != nullptr; }
+
+            // Commande appliquée avant le prochain tick
+            void RecordCommand(const Ecosystem &ecosystem, Command command, int32_t argument = 0);
+            // À appeler après chaque Ecosystem::Update
+            void RecordTick(const Ecosystem &ecosystem);
+
+            // Applique une commande à l'écosystème (jeu et rejeu passent par ici)
+            static void Apply(Ecosystem &ecosystem, Command command, int32_t argument);
+
+            // ▶ REJEU : "ecosystem" est neuf (même configuration que l'enregistrement) ; il
+            // reçoit la graine du journal puis sa population de départ, ou la sauvegarde
+            // "startSnapshot" si l'enregistrement partait d'une sauvegarde.
+            static Result Replay(Ecosystem &ecosystem, const std::string &path, const std::string &startSnapshot = "");
+            static void PrintResult(const Result &result);
+
+        private:
+            std::FILE *mFile = nullptr;
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
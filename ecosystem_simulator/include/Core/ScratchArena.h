@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef> // Pour std::size_t
+#include <memory>  // Pour std::unique_ptr
+#include <type_traits>
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🧻 MÉMOIRE TEMPORAIRE D'UN TICK
+        // Allocateur "par incrément" : une allocation avance simplement un curseur dans un
+        // gros bloc, et Reset() remet le curseur à zéro au début du tick suivant.
+        // Rien n'est libéré individuellement ; après quelques ticks le bloc a atteint la
+        // taille du pire tick et plus aucun appel à l'allocateur général n'a lieu.
+        // Réservé aux types triviaux (pas de destructeur appelé) et à un seul thread.
+        class ScratchArena
+        {
+        private:
+            struct Block
+            {
+                std::unique_ptr<unsigned char[]> data;
+                std::size_t capacity;
+            };
+
+            std::vector<Block> mBlocks; // Le premier bloc est le bloc principal
+            std::size_t mOffset;        // Curseur dans le dernier bloc
+            std::size_t mUsedBytes;     // Total demandé depuis le dernier Reset
+            std::size_t mPeakBytes;     // Pire tick observé
+
+        public:
+            // 🏗 CONSTRUCTEUR
+            explicit ScratchArena(std::size_t initialCapacity = 64 * 1024);
+
+            // Tableau de "count" éléments non initialisés, valable jusqu'au prochain Reset
+            template <typename T>
+            T *Allocate(std::size_t count)
+            {
+                static_assert(std::is_trivially_destructible<T>::value,
+                              "ScratchArena n'appelle pas les destructeurs");
+                void *memory = AllocateBytes(count * sizeof(T), alignof(T));
+                return static_cast<T *>(memory);
+            }
+
+            // Début de tick : tout ce qui a été alloué redevient disponible
+            void Reset();
+
+            // GETTERS
+            std::size_t GetUsedBytes() const { return mUsedBytes; }
+            std::size_t GetPeakBytes() const { return mPeakBytes; }
+            std::size_t GetCapacity() const;
+
+        private:
+            void *AllocateBytes(std::size_t bytes, std::size_t alignment);
+            void AddBlock(std::size_t minimumBytes);
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
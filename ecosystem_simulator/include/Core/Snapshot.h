@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        class Ecosystem;
+
+        // 💾 SAUVEGARDE BINAIRE DE LA SIMULATION
+        // Un fichier "à plat" : un en-tête fixe, puis chaque tableau du stockage des
+        // entités écrit d'un bloc (alignés sur 64 octets), puis la table des étiquettes
+        // (index de début + caractères) et la nourriture. Le chargement projette le fichier en mémoire (mmap ;
+        // lecture classique sur les systèmes qui ne l'ont pas) et recopie chaque tableau
+        // d'un seul memcpy : un monde d'un million d'entités se restaure en quelques
+        // millisecondes.
+        //
+        // Sont sauvegardés : les entités, la nourriture, la graine et les compteurs du
+        // hasard (tick, tirages du monde, prochain identifiant), les statistiques et le
+        // numéro du tick. Une simulation rechargée continue exactement comme l'originale.
+        // Les règles (espèces, limites) restent celles de la configuration courante ; la
+        // taille du monde, elle, doit être la même.
+        //
+        // Le format est celui de la machine (ordre des octets vérifié au chargement) ;
+        // kVersion augmente à chaque changement de disposition (2 : tick de naissance ;
+        // 3 : lignée et étiquettes à la place des noms ; 4 : ticks de retard des plantes
+        // au repos).
+        class Snapshot
+        {
+        public:
+            static constexpr uint32_t kVersion = 4;
+
+            // Écrit dans un fichier temporaire puis le renomme : une sauvegarde
+            // interrompue ne détruit jamais la précédente
+            static bool Save(const Ecosystem &ecosystem, const std::string &path);
+
+            // Remplace tout l'état de l'écosystème ; en cas d'erreur il n'est pas modifié
+            static bool Load(Ecosystem &ecosystem, const std::string &path);
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,190 @@
+#pragma once
+#include "Structs.h"
+#include <algorithm> // Pour std::min / std::max
+#include <cmath>     // Pour std::floor
+#include <cstddef>   // Pour std::size_t
+#include <cstdint>
+#include <utility>   // Pour std::pair
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🗺 GRILLE SPATIALE UNIFORME
+        // Le monde est découpé en cellules carrées. À chaque reconstruction, les éléments
+        // (entités ou nourriture) sont triés par cellule (tri par comptage, O(N)).
+        // Une recherche "autour de moi" ne visite alors que les quelques cellules voisines
+        // au lieu de parcourir toute la population.
+        //
+        // La grille ne stocke que des index : c'est l'appelant qui sait à quoi ils
+        // correspondent (index dans EntityStore ou dans le vecteur de Food).
+        // Les positions hors du monde sont rangées dans les cellules du bord.
+        class SpatialGrid
+        {
+        private:
+            float mCellSize;
+            float mInverseCellSize;
+            int mColumns;
+            int mRows;
+
+            // Début de chaque cellule dans mItems (taille = nombre de cellules + 1)
+            std::vector<uint32_t> mCellStart;
+            // Index des éléments, triés par cellule, et copie de leurs positions
+            std::vector<uint32_t> mItems;
+            std::vector<float> mItemX;
+            std::vector<float> mItemY;
+            // Tampon de travail : cellule de chaque élément pendant la reconstruction
+            std::vector<uint32_t> mItemCell;
+            // Tampon de travail : prochaine case libre de chaque cellule (gardé d'une
+            // reconstruction à l'autre : aucune allocation par tick)
+            std::vector<uint32_t> mCellCursor;
+
+        public:
+            // CONSTRUCTEUR
+            SpatialGrid(float worldWidth = 1.0f, float worldHeight = 1.0f, float cellSize = 50.0f);
+
+            // ⚙ CONFIGURATION / RECONSTRUCTION
+            void Configure(float worldWidth, float worldHeight, float cellSize);
+            // Les "count" premières positions (les tableaux du pool peuvent être plus longs)
+            void Build(const std::vector<float> &positionsX, const std::vector<float> &positionsY, std::size_t count);
+            void Build(const std::vector<Food> &foodSources);
+
+            // 🔍 REQUÊTES
+            // Ajoute à "results" l'index de tous les éléments à distance <= radius
+            void QueryRadius(Vector2D center, float radius, std::vector<std::size_t> &results) const;
+
+            // Remplit "results" avec les k éléments les plus proches (du plus proche au plus
+            // lointain), en se limitant à maxRadius
+            void QueryNearest(Vector2D center, std::size_t k, float maxRadius, std::vector<std::size_t> &results) const;
+
+            // Parcourt les éléments à distance <= radius : visitor(index, distanceCarrée)
+            template <typename Visitor>
+            void ForEachInRadius(Vector2D center, float radius, Visitor &&visitor) const;
+
+            // Parcourt les éléments du rectangle [minX, maxX] x [minY, maxY] : visitor(index)
+            // (seules les cellules qui touchent le rectangle sont visitées)
+            template <typename Visitor>
+            void ForEachInRect(float minX, float minY, float maxX, float maxY, Visitor &&visitor) const;
+
+            // Élément le plus proche accepté par le filtre, ou -1 si aucun dans maxRadius
+            template <typename Filter>
+            long FindNearest(Vector2D center, float maxRadius, Filter &&filter) const;
+
+            // GETTERS
+            std::size_t GetItemCount() const { return mItems.size(); }
+            float GetCellSize() const { return mCellSize; }
+            int GetColumns() const { return mColumns; }
+            int GetRows() const { return mRows; }
+            std::size_t GetCellCount() const { return static_cast<std::size_t>(mColumns) * mRows; }
+            // Cellule d'une position (ligne * colonnes + colonne ; hors du monde : cellule du bord).
+            // Même résultat que CellRow/CellColumn, sans std::floor (appel de fonction sans
+            // SSE4.1) : la troncature n'en diffère que sur ]-1, 0[, ramené à 0 de toute façon.
+            std::size_t GetCellIndex(float x, float y) const
+            {
+                int column = std::min(std::max(static_cast<int>(x * mInverseCellSize), 0), mColumns - 1);
+                int row = std::min(std::max(static_cast<int>(y * mInverseCellSize), 0), mRows - 1);
+                return static_cast<std::size_t>(row) * mColumns + column;
+            }
+
+        private:
+            int CellColumn(float x) const;
+            int CellRow(float y) const;
+            void BeginBuild(std::size_t count);
+            void FinishBuild(const float *positionsX, const float *positionsY, std::size_t stride);
+        };
+
+        // 📐 IMPLÉMENTATION DES REQUÊTES GÉNÉRIQUES (templates : doivent rester dans le .h)
+
+        inline int SpatialGrid::CellColumn(float x) const
+        {
+            int column = static_cast<int>(std::floor(x * mInverseCellSize));
+            return std::min(std::max(column, 0), mColumns - 1);
+        }
+
+        inline int SpatialGrid::CellRow(float y) const
+        {
+            int row = static_cast<int>(std::floor(y * mInverseCellSize));
+            return std::min(std::max(row, 0), mRows - 1);
+        }
+
+        template <typename Visitor>
+        void SpatialGrid::ForEachInRadius(Vector2D center, float radius, Visitor &&visitor) const
+        {
+            if (mItems.empty())
+                return;
+
+            float radiusSquared = radius * radius;
+            int minColumn = CellColumn(center.x - radius);
+            int maxColumn = CellColumn(center.x + radius);
+            int minRow = CellRow(center.y - radius);
+            int maxRow = CellRow(center.y + radius);
+
+            for (int row = minRow; row <= maxRow; ++row)
+            {
+                for (int column = minColumn; column <= maxColumn; ++column)
+                {
+                    std::size_t cell = static_cast<std::size_t>(row) * mColumns + column;
+                    for (uint32_t slot = mCellStart[cell]; slot < mCellStart[cell + 1]; ++slot)
+                    {
+                        float dx = mItemX[slot] - center.x;
+                        float dy = mItemY[slot] - center.y;
+                        float distanceSquared = dx * dx + dy * dy;
+                        if (distanceSquared <= radiusSquared)
+                        {
+                            visitor(static_cast<std::size_t>(mItems[slot]), distanceSquared);
+                        }
+                    }
+                }
+            }
+        }
+
+        template <typename Visitor>
+        void SpatialGrid::ForEachInRect(float minX, float minY, float maxX, float maxY, Visitor &&visitor) const
+        {
+            if (mItems.empty() || maxX < minX || maxY < minY)
+                return;
+
+            int minColumn = CellColumn(minX);
+            int maxColumn = CellColumn(maxX);
+            int minRow = CellRow(minY);
+            int maxRow = CellRow(maxY);
+
+            for (int row = minRow; row <= maxRow; ++row)
+            {
+                // Les cellules d'une ligne sont contiguës dans mItems
+                std::size_t first = static_cast<std::size_t>(row) * mColumns;
+                for (uint32_t slot = mCellStart[first + minColumn]; slot < mCellStart[first + maxColumn + 1]; ++slot)
+                {
+                    float x = mItemX[slot];
+                    float y = mItemY[slot];
+                    if (x >= minX && x <= maxX && y >= minY && y <= maxY)
+                    {
+                        visitor(static_cast<std::size_t>(mItems[slot]));
+                    }
+                }
+            }
+        }
+
+        template <typename Filter>
+        long SpatialGrid::FindNearest(Vector2D center, float maxRadius, Filter &&filter) const
+        {
+            long best = -1;
+            float bestDistanceSquared = maxRadius * maxRadius;
+
+            ForEachInRadius(center, maxRadius, [&](std::size_t index, float distanceSquared)
+                            {
+                                // À distance égale, le plus petit index gagne (résultat déterministe)
+                                bool closer = distanceSquared < bestDistanceSquared ||
+                                              (distanceSquared == bestDistanceSquared && static_cast<long>(index) < best);
+                                if ((best < 0 || closer) && filter(index))
+                                {
+                                    best = static_cast<long>(index);
+                                    bestDistanceSquared = distanceSquared;
+                                } });
+            return best;
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,69 @@
+#pragma once
+#include "Structs.h"
+#include <algorithm> // Pour std::copy
+#include <cstddef> // Pour std::size_t
+#include <cstdint> // Pour uint8_t
+#include <iterator> // Pour std::begin, std::end
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // ÉNUMÉRATION DES TYPES D'ENTITÉS
+        // La valeur sert d'index dans la table des espèces (au plus kMaxSpecies espèces).
+        enum class EntityType : uint8_t
+        {
+            HERBIVORE,
+            CARNIVORE,
+            PLANT
+        };
+
+        // 🧬 CARACTÉRISTIQUES D'UNE ESPÈCE
+        // Toutes les constantes qui étaient réparties dans des switch (constructeur d'Entity,
+        // ConsumeEnergy, Move, Render, SpawnRandomEntity) sont réunies ici. Le noyau de
+        // simulation lit metabolism/moveScale/moveCost au lieu de tester le type.
+        struct SpeciesTraits
+        {
+            const char *name;    // Préfixe des noms ("Herbivore_12") et des clés de configuration
+            float initialEnergy; // Énergie à l'apparition
+            float maxEnergy;
+            int maxAge;
+            float size;
+            Color color;
+            float metabolism; // Énergie consommée par seconde (négatif = produite)
+            float moveScale;  // Pixels par unité de vitesse et par seconde (0 = immobile)
+            float moveCost;   // Énergie par unité de vitesse et par seconde
+
+            constexpr bool IsMobile() const { return moveScale > 0.0f; }
+        };
+
+        // 📋 TABLE DES ESPÈCES, INDEXÉE PAR EntityType
+        // Les valeurs par défaut sont des constantes de compilation ; la configuration du
+        // monde peut en modifier certaines au démarrage ("herbivore.max_energy = 180").
+        // Ajouter une espèce = une valeur d'EntityType + une ligne dans kDefaultSpecies.
+        constexpr std::size_t kSpeciesCount = 3;
+        constexpr std::size_t kMaxSpecies = 8; // Le noyau AVX2 range une colonne de la table dans un registre
+
+        constexpr SpeciesTraits kDefaultSpecies[kSpeciesCount] = {
+            // nom          énergie max   âge  taille couleur               métab. vitesse coût
+            {"Herbivore", 80.0f, 150.0f, 200, 8.0f, Color(0, 0, 255), 1.5f, 20.0f, 0.1f},
+            {"Carnivore", 100.0f, 200.0f, 150, 12.0f, Color(255, 0, 0), 2.0f, 20.0f, 0.1f},
+            {"Plant", 50.0f, 100.0f, 300, 6.0f, Color(0, 255, 0), -0.5f, 0.0f, 0.0f},
+        };
+
+        struct SpeciesTable
+        {
+            SpeciesTraits traits[kSpeciesCount];
+
+            // Copie de kDefaultSpecies, quel que soit le nombre d'espèces
+            SpeciesTable() { std::copy(std::begin(kDefaultSpecies), std::end(kDefaultSpecies), traits); }
+
+            const SpeciesTraits &operator[](EntityType type) const { return traits[static_cast<std::size_t>(type)]; }
+            SpeciesTraits &operator[](EntityType type) { return traits[static_cast<std::size_t>(type)]; }
+        };
+
+        static_assert(kSpeciesCount <= kMaxSpecies, "Trop d'espèces pour la table du noyau");
+
+    } // namespace Core
+} // namespace Ecosystem
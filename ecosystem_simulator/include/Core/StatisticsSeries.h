@@ -0,0 +1,53 @@
+#pragma once
+#include "Species.h"
+#include <cstddef> // Pour std::size_t
+#include <cstdint>
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 📈 UN ÉCHANTILLON PAR TICK
+        struct StatisticsSample
+        {
+            uint64_t tick = 0;
+            uint32_t population[kSpeciesCount] = {}; // Indexé par EntityType
+            float meanEnergy[kSpeciesCount] = {};    // 0 si l'espèce a disparu
+            uint32_t births = 0;                     // Pendant ce tick
+            uint32_t deaths = 0;                     // Faim, vieillesse et prédation
+            uint32_t meals = 0;
+            uint32_t food = 0;                       // Nourriture restante en fin de tick
+        };
+
+        // 🔁 SÉRIE TEMPORELLE DES STATISTIQUES
+        // Anneau de taille fixe rempli par Ecosystem::Update (aucune allocation pendant la
+        // simulation). L'affichage lit les derniers échantillons ; StatisticsWriter les
+        // recopie au fil de l'eau dans un fichier en colonnes.
+        class StatisticsSeries
+        {
+        public:
+            static const std::size_t kCapacity = 4096; // Ticks conservés
+
+        private:
+            std::vector<StatisticsSample> mSamples;
+            uint64_t mCount; // Nombre total d'échantillons ajoutés
+
+        public:
+            StatisticsSeries() : mSamples(kCapacity), mCount(0) {}
+
+            void Push(const StatisticsSample &sample)
+            {
+                mSamples[mCount % kCapacity] = sample;
+                mCount++;
+            }
+
+            // 🔍 LECTURE (age 0 = le plus récent ; age < GetCount())
+            std::size_t GetCount() const { return static_cast<std::size_t>(mCount < kCapacity ? mCount : kCapacity); }
+            uint64_t GetTotalCount() const { return mCount; }
+            const StatisticsSample &Get(std::size_t age) const { return mSamples[(mCount - 1 - age) % kCapacity]; }
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
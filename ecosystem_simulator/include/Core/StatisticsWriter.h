@@ -0,0 +1,63 @@
+#pragma once
+#include "StatisticsSeries.h"
+#include <condition_variable>
+#include <cstdio> // Pour std::FILE
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🗄 ÉCRITURE DES STATISTIQUES EN COLONNES (thread d'arrière-plan)
+        // Les échantillons sont regroupés par lots de kBatchRows ticks. Un lot plein est
+        // confié au thread d'écriture pendant que la simulation remplit le suivant : le
+        // thread de simulation ne fait qu'une copie de 48 octets par tick. Si le disque
+        // ne suit pas, Append attend (aucun échantillon n'est perdu).
+        //
+        // FORMAT (ordre des octets de la machine)
+        //   En-tête : "ECOSTATS", version (u32), nombre de colonnes (u32), puis pour chaque
+        //             colonne 32 octets : nom (31 caractères, complété par des zéros) + type
+        //             (0 = u32, 1 = u64, 2 = f32).
+        //   Lots    : nombre de lignes (u32), puis chaque colonne d'un bloc, dans l'ordre de
+        //             l'en-tête. Le dernier lot peut être incomplet.
+        class StatisticsWriter
+        {
+        public:
+            static constexpr uint32_t kVersion = 1;
+            static const std::size_t kBatchRows = 4096;
+
+            StatisticsWriter();
+            ~StatisticsWriter();
+            StatisticsWriter(const StatisticsWriter &) = delete;
+            StatisticsWriter &operator=(const StatisticsWriter &) = delete;
+
+            bool Open(const std::string &path);
+            void Close(); // Écrit le lot en cours et attend la fin du thread
+            bool IsOpen() const { return mFile != nullptr; }
+
+            // À appeler après chaque tick (thread de simulation)
+            void Append(const StatisticsSample &sample);
+
+        private:
+            std::FILE *mFile;
+            std::vector<StatisticsSample> mFilling; // Lot en cours de remplissage
+            std::vector<StatisticsSample> mPending; // Lot confié au thread d'écriture
+            std::vector<unsigned char> mColumn;     // Tampon de transposition (thread d'écriture)
+
+            std::thread mThread;
+            std::mutex mMutex;
+            std::condition_variable mCondition;
+            bool mHasPending;
+            bool mStopping;
+
+            void Submit(); // Confie mFilling au thread d'écriture
+            void WriterLoop();
+            void WriteBatch(const std::vector<StatisticsSample> &rows);
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
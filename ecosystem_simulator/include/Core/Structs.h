@@ -37,6 +37,27 @@ namespace Ecosystem
             {
                 return Vector2D(x * scalar, y * scalar);
             }
+
+            // Surcharge opérateur - (vecteur "de moi vers la cible")
+            Vector2D operator-(const Vector2D &other) const
+            {
+                return Vector2D(x - other.x, y - other.y);
+            }
+
+            // Longueur du vecteur
+            float Length() const
+            {
+                return std::sqrt(x * x + y * y);
+            }
+
+            // Vecteur de même direction mais de longueur 1 (ou nul si le vecteur est nul)
+            Vector2D Normalized() const
+            {
+                float length = Length();
+                if (length <= 0.0f)
+                    return Vector2D(0.0f, 0.0f);
+                return Vector2D(x / length, y / length);
+            }
         }; // <--- Ne pas oublier ce point-virgule !
 
         struct Color
@@ -47,15 +68,15 @@ namespace Ecosystem
             uint8_t a;
 
             // Constructeurs
-            Color() : r(255), g(255), b(255), a(255) {} // Blanc par défaut
-            Color(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha = 255)
+            constexpr Color() : r(255), g(255), b(255), a(255) {} // Blanc par défaut
+            constexpr Color(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha = 255)
                 : r(red), g(green), b(blue), a(alpha) {}
 
             // Couleurs prédéfinies (Méthodes statiques)
-            static Color Red() { return Color(255, 0, 0); }
-            static Color Green() { return Color(0, 255, 0); }
-            static Color Blue() { return Color(0, 0, 255); }
-            static Color Yellow() { return Color(255, 255, 0); } // Doit être DANS la struct
+            static constexpr Color Red() { return Color(255, 0, 0); }
+            static constexpr Color Green() { return Color(0, 255, 0); }
+            static constexpr Color Blue() { return Color(0, 0, 255); }
+            static constexpr Color Yellow() { return Color(255, 255, 0); } // Doit être DANS la struct
         };
 
         struct Food
@@ -69,5 +90,19 @@ namespace Ecosystem
                 : position(pos), energyValue(energy), color(Color::Green()) {}
         };
 
+        // 🧱 BORDS DU MONDE
+        enum class BoundaryMode : uint8_t
+        {
+            Reflect, // Murs : une entité qui touche un bord rebondit
+            Wrap     // Monde torique : sortie à droite, retour à gauche
+        };
+
+        struct WorldBounds
+        {
+            float width = 1200.0f;
+            float height = 800.0f;
+            BoundaryMode mode = BoundaryMode::Reflect;
+        };
+
     } // namespace Core
 } // namespace Ecosystem
\ No newline at end of file
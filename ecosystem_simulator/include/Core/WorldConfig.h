@@ -0,0 +1,80 @@
+#pragma once
+#include "Species.h"
+#include <algorithm> // Pour std::min
+#include <cstdint>
+#include <string>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🗺 CONFIGURATION DU MONDE
+        // Toutes les limites qui étaient codées en dur (500 entités, 100 nourritures,
+        // population de départ 20/5/30...) se règlent ici, depuis un fichier "clé = valeur"
+        // (--config) puis depuis la ligne de commande (--set clé=valeur), dans cet ordre.
+        // Voir config/world.cfg pour la liste commentée des clés.
+        struct WorldConfig
+        {
+            // Monde
+            float worldWidth = 1200.0f;
+            float worldHeight = 800.0f;
+            BoundaryMode boundary = BoundaryMode::Reflect; // "reflect" ou "wrap"
+
+            // Fenêtre (0 = taille du monde, au plus kDefaultWindowWidth x kDefaultWindowHeight) ;
+            // la caméra se déplace dans un monde plus grand qu'elle
+            static constexpr float kDefaultWindowWidth = 1600.0f;
+            static constexpr float kDefaultWindowHeight = 900.0f;
+            float windowWidth = 0.0f;
+            float windowHeight = 0.0f;
+
+            // Limites (la mémoire est réservée d'avance pour ces valeurs)
+            int maxEntities = 500;
+            int maxFood = 100; // 0 = pas de limite
+
+            // Population de départ
+            int initialHerbivores = 20;
+            int initialCarnivores = 5;
+            int initialPlants = 30;
+            int initialFood = 20;
+
+            // Nourriture et plantes
+            float foodEnergy = 25.0f;        // Énergie d'une nourriture
+            int foodPerSpawn = 10;           // Nourriture ajoutée par la touche F
+            float plantGrowthChance = 0.01f; // Probabilité par tick qu'une plante pousse
+
+            // Espèces : clés "<espèce>.<caractéristique>", par exemple "herbivore.max_energy"
+            SpeciesTable species;
+
+            // Durée d'une "journée" (remise à zéro des naissances et morts du jour)
+            int ticksPerDay = 600;
+
+            // Threads de simulation (0 = un par cœur) ; le résultat n'en dépend pas
+            int threads = 0;
+
+            // Niveau de détail : loin des entités mobiles, les plantes ne sont mises à jour
+            // qu'un tick sur lodInterval (1 = toutes à chaque tick)
+            int lodInterval = 4;
+
+            // Graine du monde (aléatoire si absente)
+            bool hasSeed = false;
+            uint64_t seed = 0;
+
+            float GetWindowWidth() const { return windowWidth > 0.0f ? windowWidth : std::min(worldWidth, kDefaultWindowWidth); }
+            float GetWindowHeight() const { return windowHeight > 0.0f ? windowHeight : std::min(worldHeight, kDefaultWindowHeight); }
+
+            // 📄 Lit un fichier "clé = valeur" (lignes vides et commentaires # ignorés)
+            bool LoadFile(const std::string &path);
+
+            // ✏ Modifie une clé ; false si la clé est inconnue ou la valeur invalide
+            bool Set(const std::string &key, const std::string &value);
+
+            // "clé=valeur" (forme de la ligne de commande)
+            bool SetFromAssignment(const std::string &assignment);
+
+            // Vérifie la cohérence (tailles positives...) et journalise les erreurs
+            bool Validate() const;
+        };
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,58 @@
+#pragma once
+#include "Graphics/Renderer.h" // Pour Renderer::View
+
+namespace Ecosystem
+{
+    namespace Graphics
+    {
+
+        // 🎥 CAMÉRA (déplacement et zoom dans un monde plus grand que la fenêtre)
+        // La caméra fournit la vue du Renderer (origine + échelle) et la zone du monde visible,
+        // qui sert à ne dessiner que ce qui est à l'écran. L'échelle va de "tout le monde
+        // visible" à kMaxScale pixels d'écran par pixel du monde ; quand le monde est plus
+        // petit que l'écran sur un axe, il est centré sur cet axe.
+        class Camera
+        {
+        private:
+            float mWorldWidth;
+            float mWorldHeight;
+            float mViewportWidth;
+            float mViewportHeight;
+            float mMinScale; // Tout le monde visible
+            Renderer::View mView;
+
+        public:
+            static constexpr float kMaxScale = 8.0f;
+            static constexpr float kZoomStep = 1.25f; // Un cran de molette ou une touche +/-
+
+            Camera();
+
+            // ⚙ Taille du monde et de la zone d'affichage (en pixels) ; la vue montre tout le monde
+            void Configure(float worldWidth, float worldHeight, float viewportWidth, float viewportHeight);
+            void Fit();
+
+            // 🕹 COMMANDES (en pixels d'écran)
+            // Le monde suit le déplacement (glisser à la souris : le point saisi reste sous le curseur)
+            void Pan(float screenDeltaX, float screenDeltaY);
+            // Le point du monde sous (screenX, screenY) reste en place
+            void ZoomAt(float factor, float screenX, float screenY);
+            void Zoom(float factor) { ZoomAt(factor, mViewportWidth / 2.0f, mViewportHeight / 2.0f); }
+
+            // 🔍 GETTERS
+            const Renderer::View &GetView() const { return mView; }
+            float GetScale() const { return mView.scale; }
+            float GetViewportWidth() const { return mViewportWidth; }
+            float GetViewportHeight() const { return mViewportHeight; }
+            // Zone visible, en pixels du monde (peut déborder du monde quand il est centré)
+            float GetVisibleLeft() const { return mView.originX; }
+            float GetVisibleTop() const { return mView.originY; }
+            float GetVisibleRight() const { return mView.originX + mViewportWidth / mView.scale; }
+            float GetVisibleBottom() const { return mView.originY + mViewportHeight / mView.scale; }
+
+        private:
+            // Échelle bornée, puis origine bornée au monde (ou monde centré)
+            void Clamp();
+        };
+
+    } // namespace Graphics
+} // namespace Ecosystem
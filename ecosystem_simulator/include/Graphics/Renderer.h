@@ -1,27 +1,64 @@
 #pragma once
-#include <SDL3/SDL.h>
-#include <string>
-#include "../Core/Structs.h"
-
-namespace Ecosystem {
-namespace Graphics {
-
-    class Window {
-    private:
-        SDL_Window* mWindow;
-        SDL_Renderer* mRenderer;
-        float mWidth, mHeight;
-        std::string mTitle;
-        bool mIsInitialized;
-
-    public:
-        Window(const std::string& title, float width, float height);
-        ~Window();
-        bool Initialize();
-        void Shutdown();
-        void Clear(const Core::Color& color = Core::Color(30, 30, 30));
-        void Present();
-        SDL_Renderer* GetRenderer() const { return mRenderer; }
-    };
-}
-}
\ No newline at end of file
+#include <SDL3/SDL.h>     // pour SDL_Renderer et SDL_Vertex
+#include <cstddef>        // pour std::size_t
+#include <vector>         // pour std::vector
+#include "Core/Structs.h" // Pour utiliser Core::Color
+
+namespace Ecosystem
+{
+    namespace Graphics
+    {
+
+        // 🖌 RENDU PAR LOTS
+        // Au lieu d'appeler SDL_SetRenderDrawColor + SDL_RenderFillRect pour chaque carré,
+        // on accumule tous les rectangles de l'image dans un seul tableau de sommets
+        // (position + couleur entrelacées) et on l'envoie en quelques SDL_RenderGeometry.
+        // Les tableaux sont conservés d'une image à l'autre : pas d'allocation en régime établi.
+        //
+        // Les rectangles sont donnés en coordonnées du monde ; la vue (origine + échelle) les
+        // place sur la cible : cible = (monde - origine) * échelle.
+        class Renderer
+        {
+        public:
+            struct View
+            {
+                float originX = 0.0f;
+                float originY = 0.0f;
+                float scale = 1.0f;
+            };
+
+        private:
+            SDL_Renderer *mRenderer; // Appartient à Window, on ne le détruit pas ici
+
+            std::vector<SDL_Vertex> mVertices; // 4 sommets par rectangle
+            std::vector<int> mIndices;         // 6 index par rectangle (2 triangles), motif fixe
+            std::size_t mDrawCalls;            // Appels SDL_RenderGeometry de la dernière image
+            View mView;
+
+        public:
+            // 🏗 CONSTRUCTEUR
+            explicit Renderer(SDL_Renderer *renderer = nullptr);
+
+            // Le renderer SDL n'existe qu'après Window::Initialize
+            void SetTarget(SDL_Renderer *renderer) { mRenderer = renderer; }
+
+            // 🔭 VUE (s'applique aux rectangles ajoutés ensuite)
+            void SetView(const View &view) { mView = view; }
+            const View &GetView() const { return mView; }
+
+            // 🎨 CONSTRUCTION DU LOT
+            void Begin();
+            void FillRect(float x, float y, float width, float height, const Core::Color &color);
+            void Flush();
+
+            // 🔍 GETTERS
+            SDL_Renderer *GetSDLRenderer() const { return mRenderer; }
+            std::size_t GetRectCount() const { return mVertices.size() / 4; }
+            std::size_t GetDrawCallCount() const { return mDrawCalls; }
+
+        private:
+            void EnsureIndices(std::size_t rectCount);
+        };
+
+    } // namespace Graphics
+} // namespace Ecosystem
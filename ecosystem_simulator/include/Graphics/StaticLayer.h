@@ -0,0 +1,57 @@
+#pragma once
+#include <SDL3/SDL.h>           // pour SDL_Renderer et SDL_Texture
+#include "Core/DirtyRegions.h"  // Tuiles à redessiner
+#include "Graphics/Renderer.h"
+
+namespace Ecosystem
+{
+    namespace Graphics
+    {
+
+        // 🖼 COUCHE STATIQUE (nourriture et plantes)
+        // Le décor immobile est dessiné une fois dans une texture de la taille du monde,
+        // puis recopié d'un seul appel à chaque image. Seules les tuiles marquées dans
+        // Core::DirtyRegions sont effacées et redessinées : quand rien ne change, une image
+        // ne coûte plus que le dessin des entités mobiles.
+        //
+        // Un monde plus grand que kMaxTextureSize est réduit dans la texture (les carrés y
+        // sont plus petits, puis agrandis à l'affichage).
+        class StaticLayer
+        {
+        private:
+            SDL_Renderer *mOwner; // Renderer qui a créé la texture (appartient à Window)
+            SDL_Texture *mTexture;
+            float mWorldWidth;
+            float mWorldHeight;
+            float mScale; // Pixels de texture par pixel du monde
+            Renderer::View mSavedView;
+
+        public:
+            static const int kMaxTextureSize = 4096;
+
+            StaticLayer();
+            ~StaticLayer();
+            StaticLayer(const StaticLayer &) = delete;
+            StaticLayer &operator=(const StaticLayer &) = delete;
+
+            // ⚙ Crée la texture si besoin ; true si elle vient d'être (re)créée : son contenu
+            // est alors indéfini et tout doit être redessiné
+            bool Prepare(SDL_Renderer *renderer, float worldWidth, float worldHeight);
+            bool IsReady() const { return mTexture != nullptr; }
+            float GetScale() const { return mScale; } // Pixels de texture par pixel du monde
+
+            // À appeler avant la destruction du renderer SDL, ou si ses textures sont perdues
+            void Release();
+
+            // 🧽 RETOUCHE : BeginPatch efface les tuiles marquées ; l'appelant ajoute au lot le
+            // décor qui touche ces tuiles (en coordonnées du monde) ; EndPatch envoie le lot
+            // dans la texture
+            void BeginPatch(Renderer &batch, const Core::DirtyRegions &dirty);
+            void EndPatch(Renderer &batch);
+
+            // 🎨 Copie de la texture sur la cible courante, à travers la vue du lot
+            void Draw(Renderer &batch) const;
+        };
+
+    } // namespace Graphics
+} // namespace Ecosystem
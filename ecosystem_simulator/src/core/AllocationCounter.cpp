@@ -0,0 +1,54 @@
+#include "Core/AllocationCounter.h"
+#include <atomic>
+#include <cstdlib> // Pour std::malloc, std::free
+#include <new>     // Pour std::bad_alloc
+
+// Activé par défaut : le coût est d'un incrément atomique par allocation
+#ifndef ECOSYSTEM_TRACK_ALLOCATIONS
+#define ECOSYSTEM_TRACK_ALLOCATIONS 1
+#endif
+
+namespace
+{
+    std::atomic<uint64_t> gAllocationCount(0);
+}
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        uint64_t GetAllocationCount()
+        {
+            return gAllocationCount.load(std::memory_order_relaxed);
+        }
+
+        bool IsAllocationCountingEnabled()
+        {
+            return ECOSYSTEM_TRACK_ALLOCATIONS != 0;
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
+
+#if ECOSYSTEM_TRACK_ALLOCATIONS
+// 🪝 REMPLACEMENT DE L'OPÉRATEUR NEW GLOBAL
+// Les autres formes (new[], nothrow) passent par celle-ci dans la bibliothèque standard.
+void *operator new(std::size_t size)
+{
+    gAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size > 0 ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+#endif
@@ -0,0 +1,69 @@
+#include "Core/DirtyRegions.h"
+#include <algorithm> // Pour std::min, std::max, std::fill
+#include <cmath>     // Pour std::ceil, std::floor
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🏗 CONSTRUCTEUR
+        DirtyRegions::DirtyRegions(float worldWidth, float worldHeight)
+            : mColumns(0), mRows(0)
+        {
+            Configure(worldWidth, worldHeight);
+        }
+
+        void DirtyRegions::Configure(float worldWidth, float worldHeight)
+        {
+            mColumns = std::max(1, static_cast<int>(std::ceil(worldWidth / kTileSize)));
+            mRows = std::max(1, static_cast<int>(std::ceil(worldHeight / kTileSize)));
+            mTiles.assign(static_cast<std::size_t>(mColumns) * mRows, 0);
+            mDirtyList.clear();
+            mDirtyList.reserve(mTiles.size()); // Aucune allocation ensuite, même pour MarkAll
+        }
+
+        void DirtyRegions::TileRange(float x, float y, float halfSize, int &firstColumn, int &lastColumn,
+                                     int &firstRow, int &lastRow) const
+        {
+            firstColumn = std::max(static_cast<int>(std::floor((x - halfSize) / kTileSize)), 0);
+            lastColumn = std::min(static_cast<int>(std::floor((x + halfSize) / kTileSize)), mColumns - 1);
+            firstRow = std::max(static_cast<int>(std::floor((y - halfSize) / kTileSize)), 0);
+            lastRow = std::min(static_cast<int>(std::floor((y + halfSize) / kTileSize)), mRows - 1);
+        }
+
+        // ✏ MARQUAGE
+        void DirtyRegions::Mark(float x, float y, float halfSize)
+        {
+            int firstColumn, lastColumn, firstRow, lastRow;
+            TileRange(x, y, halfSize, firstColumn, lastColumn, firstRow, lastRow);
+            for (int row = firstRow; row <= lastRow; ++row)
+            {
+                for (int column = firstColumn; column <= lastColumn; ++column)
+                {
+                    std::size_t tile = static_cast<std::size_t>(row) * mColumns + column;
+                    if (mTiles[tile])
+                        continue;
+                    mTiles[tile] = 1;
+                    mDirtyList.push_back(static_cast<uint32_t>(tile));
+                }
+            }
+        }
+
+        void DirtyRegions::MarkAll()
+        {
+            std::fill(mTiles.begin(), mTiles.end(), 1);
+            mDirtyList.clear();
+            for (std::size_t tile = 0; tile < mTiles.size(); ++tile)
+                mDirtyList.push_back(static_cast<uint32_t>(tile));
+        }
+
+        void DirtyRegions::Clear()
+        {
+            for (uint32_t tile : mDirtyList)
+                mTiles[tile] = 0;
+            mDirtyList.clear();
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -1,35 +1,123 @@
-#include "Ecosystem.h"
-#include <iostream>
-#include <algorithm> // Pour std::remove_if
+#include "Core/Ecosystem.h"
+#include "Core/EntityKernel.h"
+#include "Core/Logger.h"
+#include <algorithm> // Pour std::min, std::sort
 #include <cmath>     // Pour std::sqrt (si besoin)
+#include <cstring>   // Pour std::memcpy
+#include <numeric>   // Pour std::iota
+#include <random>    // Pour std::random_device (graine par défaut)
 
 namespace Ecosystem
 {
     namespace Core
     {
 
+        // ⚙ PARAMÈTRES DES INTERACTIONS
+        namespace
+        {
+            constexpr float kGridCellSize = 50.0f;    // Taille d'une cellule des grilles spatiales
+            constexpr float kFoodRadius = 3.0f;       // Demi-côté d'un carré de nourriture
+            constexpr float kGrazingBite = 15.0f;     // Énergie prise à une plante par bouchée
+            constexpr float kPreyEnergyShare = 0.5f;  // Part de l'énergie d'une proie récupérée
+            constexpr float kSteeringStrength = 2.0f; // Réactivité du pilotage
+            constexpr std::size_t kChunkSize = 2048;  // Entités par bloc de travail parallèle
+
+            // Rendu : en dessous de cette échelle (pixels d'écran par pixel du monde), les entités
+            // mobiles ne font plus qu'un ou deux pixels et sont regroupées en tuiles de densité
+            constexpr float kHeatmapScale = 0.25f;
+            constexpr float kHeatmapTilePixels = 8.0f; // Côté d'une tuile de densité, à l'écran
+
+            // Prépare un tampon vide par bloc (la capacité est conservée d'un tick à l'autre)
+            template <typename T>
+            void ResetChunkBuffers(std::vector<std::vector<T>> &buffers, std::size_t chunks)
+            {
+                if (buffers.size() < chunks)
+                    buffers.resize(chunks);
+                for (auto &buffer : buffers)
+                    buffer.clear();
+            }
+        }
+
         // 🏗 CONSTRUCTEUR
-        Ecosystem::Ecosystem(float width, float height, int maxEntities)
-            : mWorldWidth(width), mWorldHeight(height), mMaxEntities(maxEntities),
-              mDayCycle(0), mRandomGenerator(std::random_device{}())
+        Ecosystem::Ecosystem(const WorldConfig &config)
+            : mConfig(config),
+              mDayCycle(0), mWorldDraws(0),
+              mEntityGrid(config.worldWidth, config.worldHeight, kGridCellSize),
+              mFoodGrid(config.worldWidth, config.worldHeight, kGridCellSize),
+              mUnindexedFoodBegin(0),
+              mLod(config.lodInterval),
+              mStaticDirty(config.worldWidth, config.worldHeight),
+              mJobs(static_cast<unsigned>(std::max(config.threads, 0))),
+              mTickEvents{0, 0, 0}
         {
+            // Graine imprévisible par défaut ; SetSeed (ou la clé "seed") permet de la fixer
+            if (config.hasSeed)
+            {
+                mEntities.random.SetSeed(config.seed);
+            }
+            else
+            {
+                std::random_device device;
+                mEntities.random.SetSeed((static_cast<uint64_t>(device()) << 32) | device());
+            }
+
+            // Caractéristiques des espèces (valeurs par défaut ou lues dans la configuration)
+            mEntities.species = config.species;
+            mEntities.bounds = {config.worldWidth, config.worldHeight, config.boundary};
+
+            // Le pool d'entités et la nourriture sont dimensionnés une fois pour les maximums :
+            // aucune réallocation pendant la simulation, même à un million d'entités
+            std::size_t maxEntities = static_cast<std::size_t>(std::max(config.maxEntities, 0));
+            mEntities.Reserve(maxEntities);
+            mDeadEntities.reserve(maxEntities);
+            mEntityRemap.reserve(maxEntities);
+            mEntityItem.reserve(maxEntities);
+            mUnindexedEntities.reserve(maxEntities);
+            if (config.maxFood > 0)
+            {
+                mFoodSources.reserve(static_cast<std::size_t>(config.maxFood));
+                mFoodEaten.reserve(static_cast<std::size_t>(config.maxFood));
+                mFoodRemap.reserve(static_cast<std::size_t>(config.maxFood));
+            }
+
             // Initialisation des statistiques
             mStats = {0, 0, 0, 0, 0, 0};
-            std::cout << "🌍 Écosystème créé: " << width << "x" << height << std::endl;
+            ECO_LOG_INFO("🌍 Écosystème créé: %gx%g (max %d entités, %d nourritures)",
+                         config.worldWidth, config.worldHeight, config.maxEntities, config.maxFood);
+        }
+
+        namespace
+        {
+            WorldConfig MakeConfig(float width, float height, int maxEntities)
+            {
+                WorldConfig config;
+                config.worldWidth = width;
+                config.worldHeight = height;
+                config.maxEntities = maxEntities;
+                return config;
+            }
+        }
+
+        Ecosystem::Ecosystem(float width, float height, int maxEntities)
+            : Ecosystem(MakeConfig(width, height, maxEntities))
+        {
         }
 
         // 🗑 DESTRUCTEUR
         Ecosystem::~Ecosystem()
         {
-            std::cout << "🌍 Écosystème détruit (" << mEntities.size() << " entités nettoyées)" << std::endl;
+            ECO_LOG_INFO("🌍 Écosystème détruit (%zu entités nettoyées)", mEntities.Size());
         }
 
         // ⚙ INITIALISATION
         // J'ai réparé la liste des arguments qui était coupée
         void Ecosystem::Initialize(int initialHerbivores, int initialCarnivores, int initialPlants)
         {
-            mEntities.clear();
+            mEntities.Clear();
             mFoodSources.clear();
+            mEntityItem.clear(); // Tables du rendu refaites par RebuildSpatialIndex, plus bas
+            mUnindexedEntities.clear();
+            mStaticDirty.MarkAll();
 
             // Création des entités initiales
             for (int i = 0; i < initialHerbivores; ++i)
@@ -46,199 +134,784 @@ namespace Ecosystem
             }
 
             // Nourriture initiale
-            SpawnFood(20);
-            std::cout << "🌱 Écosystème initialisé avec " << mEntities.size() << " entités" << std::endl;
+            SpawnFood(mConfig.initialFood);
+            RebuildSpatialIndex(); // Pour le rendu ; le premier tick la refait de toute façon
+            ECO_LOG_INFO("🌱 Écosystème initialisé avec %zu entités (graine %llu)", mEntities.Size(),
+                         static_cast<unsigned long long>(GetSeed()));
+        }
+
+        void Ecosystem::Initialize()
+        {
+            Initialize(mConfig.initialHerbivores, mConfig.initialCarnivores, mConfig.initialPlants);
+        }
+
+        // 🎲 GRAINE DU MONDE
+        void Ecosystem::SetSeed(uint64_t seed)
+        {
+            mEntities.random.SetSeed(seed);
+            ECO_LOG_INFO("🎲 Graine du monde: %llu", static_cast<unsigned long long>(seed));
+        }
+
+        // 🔑 EMPREINTE DE L'ÉTAT
+        namespace
+        {
+            // Mélange mot par mot (multiplication + décalage, comme SplitMix64)
+            uint64_t HashBytes(uint64_t hash, const void *data, std::size_t bytes)
+            {
+                const unsigned char *bytePointer = static_cast<const unsigned char *>(data);
+                std::size_t words = bytes / sizeof(uint64_t);
+                for (std::size_t w = 0; w < words; ++w)
+                {
+                    uint64_t word;
+                    std::memcpy(&word, bytePointer + w * sizeof(uint64_t), sizeof(word));
+                    hash = (hash ^ word) * 0x9E3779B97F4A7C15ull;
+                    hash ^= hash >> 32;
+                }
+                uint64_t tail = 0;
+                std::memcpy(&tail, bytePointer + words * sizeof(uint64_t), bytes - words * sizeof(uint64_t));
+                hash = (hash ^ tail ^ bytes) * 0xBF58476D1CE4E5B9ull;
+                return hash ^ (hash >> 31);
+            }
+
+            template <typename T>
+            uint64_t HashColumn(uint64_t hash, const std::vector<T> &column, std::size_t count)
+            {
+                return HashBytes(hash, column.data(), count * sizeof(T));
+            }
+        }
+
+        uint64_t Ecosystem::ComputeStateHash() const
+        {
+            std::size_t count = mEntities.Size();
+            uint64_t counters[5] = {mEntities.random.GetSeed(), mWorldDraws, mEntities.nextId,
+                                    static_cast<uint64_t>(mDayCycle), count};
+            uint64_t hash = HashBytes(0, counters, sizeof(counters));
+
+            // Toutes les colonnes sauvegardées : une divergence de calendrier (lodDebt) ou de
+            // lignée (parent, étiquette...) se voit dès le tick où elle apparaît
+            EntityStore::ForEachPersistentColumn(mEntities, [&hash, count](const auto &column)
+                                                 { hash = HashColumn(hash, column, count); });
+            for (const std::string &label : mEntities.GetLabels())
+            {
+                uint64_t length = label.size();
+                hash = HashBytes(hash, &length, sizeof(length));
+                hash = HashBytes(hash, label.data(), label.size());
+            }
+            for (const Food &food : mFoodSources)
+            {
+                float values[3] = {food.position.x, food.position.y, food.energyValue};
+                hash = HashBytes(hash, values, sizeof(values));
+            }
+            return hash;
         }
 
         // 🔄 MISE À JOUR
         void Ecosystem::Update(float deltaTime)
         {
-            // Mise à jour de toutes les entités
-            for (auto &entity : mEntities)
+            // Les tirages des entités pendant ce tick dépendent du numéro du tick
+            mEntities.tick = static_cast<uint64_t>(mDayCycle);
+            mEntities.census.Advance(mEntities.tick);
+            mScratch.Reset();
+            mProfiler.BeginTick(mEntities.tick);
+            mTickEvents = {0, 0, 0};
+
+            // Nouvelle journée : les compteurs du jour repartent de zéro
+            if (mDayCycle > 0 && mDayCycle % mConfig.ticksPerDay == 0)
+            {
+                mStats.deathsToday = 0;
+                mStats.birthsToday = 0;
+            }
+
+            {
+                ScopedTimer timer(mProfiler, ProfilePhase::Movement);
+
+                // Positions de départ du pas (pour l'interpolation du rendu)
+                mEntities.SavePreviousPositions();
+
+                // Mise à jour de toutes les entités (en parallèle, par blocs)
+                mDeadEntities.clear();
+                UpdateEntities(deltaTime);
+            }
+
+            // Index spatiaux à jour avant toute recherche de voisins
             {
-                entity->Update(deltaTime);
+                ScopedTimer timer(mProfiler, ProfilePhase::SpatialIndex);
+                RebuildSpatialIndex();
+            }
+            {
+                ScopedTimer timer(mProfiler, ProfilePhase::Steering);
+                ApplySteering(deltaTime);
             }
 
             // Gestion des comportements
-            HandleEating();
-            HandleReproduction();
-            RemoveDeadEntities();
-            HandlePlantGrowth(deltaTime);
+            {
+                ScopedTimer timer(mProfiler, ProfilePhase::Eating);
+                HandleEating();
+            }
+            {
+                ScopedTimer timer(mProfiler, ProfilePhase::Reproduction);
+                HandleReproduction();
+            }
+            {
+                ScopedTimer timer(mProfiler, ProfilePhase::Culling);
+                RemoveDeadEntities();
+            }
+            {
+                ScopedTimer timer(mProfiler, ProfilePhase::PlantGrowth);
+                HandlePlantGrowth(deltaTime);
+            }
 
             // Mise à jour des statistiques
-            UpdateStatistics();
+            {
+                ScopedTimer timer(mProfiler, ProfilePhase::Statistics);
+                UpdateStatistics();
+            }
+
+            mProfiler.EndTick(mEntities.Size(), mFoodSources.size());
             mDayCycle++;
         }
 
         // 🍎 GÉNÉRATION DE NOURRITURE
         void Ecosystem::SpawnFood(int count)
         {
+            // Limite maximale de nourriture (0 = pas de limite)
+            if (mConfig.maxFood > 0)
+            {
+                std::size_t room = static_cast<std::size_t>(mConfig.maxFood) - std::min(mFoodSources.size(), static_cast<std::size_t>(mConfig.maxFood));
+                count = static_cast<int>(std::min(static_cast<std::size_t>(std::max(count, 0)), room));
+            }
             for (int i = 0; i < count; ++i)
             {
-                if (mFoodSources.size() < 100)
-                { // Limite maximale de nourriture
-                    Vector2D position = GetRandomPosition();
-                    mFoodSources.emplace_back(position, 25.0f);
-                }
+                Vector2D position = GetRandomPosition();
+                mFoodSources.emplace_back(position, mConfig.foodEnergy);
+                mStaticDirty.Mark(position.x, position.y, kFoodRadius);
             }
         }
 
         // 💀 SUPPRESSION DES ENTITÉS MORTES
         void Ecosystem::RemoveDeadEntities()
         {
-            int initialCount = mEntities.size();
+            // Personne n'est mort pendant ce tick : rien à compacter
+            if (mDeadEntities.empty())
+                return;
+
+            // Le décor immobile disparu est à effacer de la couche statique
+            for (std::size_t dead : mDeadEntities)
+            {
+                if (!mEntities.species[mEntities.type[dead]].IsMobile())
+                    mStaticDirty.Mark(mEntities.positionX[dead], mEntities.positionY[dead], mEntities.size[dead] / 2.0f);
+            }
 
-            // Utilisation de remove_if avec un lambda pour nettoyer le vecteur
-            // Correction du template <Entity> manquant
-            mEntities.erase(
-                std::remove_if(mEntities.begin(), mEntities.end(),
-                               [](const std::unique_ptr<Entity> &entity)
-                               {
-                                   return !entity->IsAlive();
-                               }),
-                mEntities.end());
+            // Seules les colonnes des morts sont touchées (échange avec la dernière colonne)
+            std::size_t count = mEntities.Size();
+            int removedCount = static_cast<int>(mEntities.RemoveDead(mDeadEntities));
 
-            int removedCount = initialCount - mEntities.size();
+            // Mêmes échanges dans les tables du rendu (morts triés du plus grand au plus petit)
+            for (std::size_t dead : mDeadEntities)
+            {
+                std::size_t last = --count;
+                uint32_t item = mEntityItem[dead];
+                if (item != kNotIndexed)
+                    mEntityRemap[item] = kNotIndexed;
+                if (dead != last)
+                {
+                    item = mEntityItem[last];
+                    mEntityItem[dead] = item;
+                    if (item != kNotIndexed)
+                        mEntityRemap[item] = static_cast<uint32_t>(dead);
+                }
+            }
+            mEntityItem.resize(count);
+            mDeadEntities.clear();
             if (removedCount > 0)
             {
                 mStats.deathsToday += removedCount;
+                mTickEvents.deaths += static_cast<uint32_t>(removedCount);
             }
         }
 
         // 👶 GESTION DE LA REPRODUCTION
         void Ecosystem::HandleReproduction()
         {
-            // Correction du template manquant <std::unique_ptr<Entity>>
-            std::vector<std::unique_ptr<Entity>> newEntities;
+            // On ne note que l'index des parents : les bébés sont ajoutés après la boucle
+            std::size_t count = mEntities.Size();
+            std::size_t maxEntities = static_cast<std::size_t>(mConfig.maxEntities);
+            if (count >= maxEntities)
+                return;
+
+            // Chaque bloc décide des naissances de ses entités (générateur propre à chacune) ;
+            // le coût n'est payé qu'une fois la naissance acceptée, pendant la fusion
+            std::size_t chunks = JobSystem::ChunkCount(count, kChunkSize);
+            ResetChunkBuffers(mChunkBirths, chunks);
+            mJobs.ParallelFor(count, kChunkSize, [this](std::size_t chunk, std::size_t begin, std::size_t end)
+                              {
+                                  for (std::size_t i = begin; i < end; ++i)
+                                  {
+                                      Entity entity(mEntities, i);
+                                      // Logique de reproduction
+                                      if (entity.WantsToReproduce())
+                                      {
+                                          mChunkBirths[chunk].push_back(i);
+                                      }
+                                  } });
 
-            for (auto &entity : mEntities)
+            // Fusion dans l'ordre des blocs, dans la mémoire temporaire du tick. Seuls les
+            // premiers parents trouvés ont un bébé : la population ne dépasse jamais le
+            // maximum, donc jamais la capacité réservée.
+            std::size_t birthCount = 0;
+            for (std::size_t chunk = 0; chunk < chunks; ++chunk)
             {
-                // Logique de reproduction
-                if (entity->CanReproduce() && mEntities.size() < mMaxEntities)
-                {
-                    auto baby = entity->Reproduce();
-                    if (baby)
-                    {
-                        // std::move est essentiel car unique_ptr ne se copie pas
-                        newEntities.push_back(std::move(baby));
-                        mStats.birthsToday++;
-                    }
-                }
+                birthCount += mChunkBirths[chunk].size();
             }
+            birthCount = std::min(birthCount, maxEntities - count);
+            std::size_t *pendingBirths = mScratch.Allocate<std::size_t>(birthCount);
+            std::size_t written = 0;
+            for (std::size_t chunk = 0; chunk < chunks && written < birthCount; ++chunk)
+            {
+                std::size_t taken = std::min(mChunkBirths[chunk].size(), birthCount - written);
+                std::copy(mChunkBirths[chunk].begin(), mChunkBirths[chunk].begin() + taken, pendingBirths + written);
+                written += taken;
+            }
+            mStats.birthsToday += static_cast<int>(birthCount);
+            mTickEvents.births = static_cast<uint32_t>(birthCount);
 
-            // Ajout des nouveaux bébés à la liste principale
-            for (auto &newEntity : newEntities)
+            // Ajout des nouveaux bébés à la fin des tableaux (cases libres du pool réutilisées)
+            for (std::size_t b = 0; b < birthCount; ++b)
             {
-                mEntities.push_back(std::move(newEntity));
+                Entity(mEntities, pendingBirths[b]).PayReproductionCost();
+                TrackStaticTint(pendingBirths[b]);
+                OnEntityAdded(mEntities.AddChild(pendingBirths[b]));
             }
         }
 
         // 🍽 GESTION DE L'ALIMENTATION
         void Ecosystem::HandleEating()
         {
-            // TODO: C'est ici qu'il faudra ajouter la logique pour les Carnivores/Herbivores !
-            // Pour l'instant, seules les plantes "mangent" (photosynthèse simplifiée)
-            for (auto &entity : mEntities)
+            // 1) En parallèle : chaque mangeur cherche sa cible dans les grilles (lecture seule)
+            //    et la note dans le tampon de son bloc.
+            std::size_t count = mEntities.Size();
+            std::size_t chunks = JobSystem::ChunkCount(count, kChunkSize);
+            ResetChunkBuffers(mChunkClaims, chunks);
+            ResetChunkBuffers(mChunkRepaints, chunks);
+            mChunkEnergy.assign(chunks, EnergyLedger());
+
+            mJobs.ParallelFor(count, kChunkSize, [this](std::size_t chunk, std::size_t begin, std::size_t end)
+                              {
+                                  for (std::size_t i = begin; i < end; ++i)
+                                  {
+                                      if (!mEntities.alive[i])
+                                          continue;
+
+                                      Entity entity(mEntities, i);
+                                      Vector2D position = entity.GetPosition();
+                                      FeedingKind kind = FeedingKind::Food;
+                                      long target = -1;
+
+                                      switch (mEntities.type[i])
+                                      {
+                                      case EntityType::PLANT:
+                                          // Les plantes génèrent de l'énergie passivement (elles ne touchent qu'à elles-mêmes),
+                                          // pour chaque tick rattrapé si elles étaient au repos. Leur énergie
+                                          // n'a pas changé ailleurs depuis le tick précédent (métabolisme du
+                                          // noyau compris) : c'est ici qu'un changement de teinte se voit.
+                                          if (mEntities.updateSteps[i] > 0)
+                                          {
+                                              entity.Eat(0.1f * mEntities.updateSteps[i], &mChunkEnergy[chunk]);
+                                              if (entity.GetTintLevel() != mEntities.staticTint[i])
+                                                  mChunkRepaints[chunk].push_back(i);
+                                          }
+                                          break;
+                                      case EntityType::HERBIVORE:
+                                          // Nourriture la plus proche au contact, sinon une plante à brouter
+                                          target = mFoodGrid.FindNearest(position, entity.GetSize() / 2.0f + kFoodRadius,
+                                                                         [](std::size_t)
+                                                                         { return true; });
+                                          if (target < 0)
+                                          {
+                                              kind = FeedingKind::Plant;
+                                              target = mEntityGrid.FindNearest(position, entity.GetSize(),
+                                                                               [this](std::size_t other)
+                                                                               {
+                                                                                   return mEntities.alive[other] && mEntities.type[other] == EntityType::PLANT;
+                                                                               });
+                                          }
+                                          break;
+                                      case EntityType::CARNIVORE:
+                                          // Herbivore vivant au contact
+                                          kind = FeedingKind::Prey;
+                                          target = mEntityGrid.FindNearest(position, entity.GetSize(),
+                                                                           [this](std::size_t other)
+                                                                           {
+                                                                               return mEntities.alive[other] && mEntities.type[other] == EntityType::HERBIVORE;
+                                                                           });
+                                          break;
+                                      }
+
+                                      if (target >= 0)
+                                      {
+                                          Vector2D targetPosition = kind == FeedingKind::Food
+                                                                        ? mFoodSources[target].position
+                                                                        : Vector2D(mEntities.positionX[target], mEntities.positionY[target]);
+                                          float dx = targetPosition.x - position.x;
+                                          float dy = targetPosition.y - position.y;
+                                          mChunkClaims[chunk].push_back({kind, static_cast<uint32_t>(i), static_cast<uint32_t>(target),
+                                                                         dx * dx + dy * dy});
+                                      }
+                                  } });
+
+            // 2) Toutes les demandes du tick, triées : les demandes d'une même cible se suivent,
+            //    la plus proche en tête (égalité : le plus petit identifiant, stable d'une
+            //    exécution à l'autre contrairement à l'index)
+            std::size_t claimCount = 0;
+            for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                mEntities.census.Apply(mChunkEnergy[chunk]);
+                claimCount += mChunkClaims[chunk].size();
+                for (std::size_t plant : mChunkRepaints[chunk])
+                    TrackStaticTint(plant);
+            }
+            FeedingClaim *claims = mScratch.Allocate<FeedingClaim>(claimCount);
+            std::size_t written = 0;
+            for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                std::copy(mChunkClaims[chunk].begin(), mChunkClaims[chunk].end(), claims + written);
+                written += mChunkClaims[chunk].size();
+            }
+            std::sort(claims, claims + claimCount, [this](const FeedingClaim &a, const FeedingClaim &b)
+                      {
+                          if (a.kind != b.kind)
+                              return a.kind < b.kind;
+                          if (a.target != b.target)
+                              return a.target < b.target;
+                          if (a.distanceSquared != b.distanceSquared)
+                              return a.distanceSquared < b.distanceSquared;
+                          return mEntities.id[a.eater] < mEntities.id[b.eater]; });
+
+            // 3) Résolution : une cible nourrit un seul mangeur par tick, le premier de son
+            //    groupe encore vivant. Les proies passent en premier : un herbivore dévoré ne
+            //    mange plus, et une proie déjà prise ne l'est pas deux fois.
+            mFoodEaten.assign(mFoodSources.size(), 0);
+            uint64_t meals = 0;
+            uint64_t preyed = 0;
+            uint64_t grazedAway = 0;
+            bool served = false;
+            for (std::size_t c = 0; c < claimCount; ++c)
+            {
+                const FeedingClaim &claim = claims[c];
+                if (c == 0 || claims[c - 1].kind != claim.kind || claims[c - 1].target != claim.target)
+                    served = false; // Nouvelle cible
+                // Cible déjà prise, ou mangeur dévoré plus tôt dans la résolution
+                if (served || !mEntities.alive[claim.eater])
+                    continue;
+
+                Entity eater(mEntities, claim.eater);
+                switch (claim.kind)
+                {
+                case FeedingKind::Prey:
+                    // Le carnivore récupère une partie de l'énergie de sa proie
+                    eater.Eat(mEntities.energy[claim.target] * kPreyEnergyShare);
+                    mEntities.alive[claim.target] = 0;
+                    mDeadEntities.push_back(claim.target);
+                    preyed++;
+                    break;
+                case FeedingKind::Food:
+                    eater.Eat(mFoodSources[claim.target].energyValue);
+                    mFoodEaten[claim.target] = 1;
+                    break;
+                case FeedingKind::Plant:
+                {
+                    // Une bouchée ; la plante ne meurt que si elle y laisse toute son énergie
+                    float plantEnergy = mEntities.energy[claim.target];
+                    float bite = std::min(kGrazingBite, plantEnergy);
+                    mEntities.SetEnergy(claim.target, plantEnergy - bite);
+                    TrackStaticTint(claim.target);
+                    eater.Eat(bite);
+                    if (plantEnergy - bite <= 0.0f)
+                    {
+                        mEntities.alive[claim.target] = 0;
+                        mDeadEntities.push_back(claim.target);
+                        grazedAway++;
+                    }
+                    break;
+                }
+                }
+                served = true;
+                meals++;
+            }
+
+            // Un seul ajout aux compteurs par tick (pas d'atomique par repas)
+            mTickEvents.meals = static_cast<uint32_t>(meals);
+            Logger::Instance().CountEvent(LifecycleEvent::Meal, meals);
+            Logger::Instance().CountEvent(LifecycleEvent::Preyed, preyed);
+            Logger::Instance().CountEvent(LifecycleEvent::Grazed, grazedAway);
+
+            // Retrait groupé de la nourriture mangée (l'ordre est conservé). Le nouvel index de
+            // chaque survivant met à jour la table de la grille utilisée par le rendu.
+            uint32_t *moved = mScratch.Allocate<uint32_t>(mFoodSources.size());
+            std::size_t unindexedBegin = mUnindexedFoodBegin;
+            std::size_t write = 0;
+            for (std::size_t f = 0; f < mFoodSources.size(); ++f)
             {
-                if (entity->GetType() == EntityType::PLANT)
+                if (f == mUnindexedFoodBegin)
+                    unindexedBegin = write;
+                if (!mFoodEaten[f])
                 {
-                    // Les plantes génèrent de l'énergie passivement
-                    entity->Eat(0.1f);
+                    moved[f] = static_cast<uint32_t>(write);
+                    mFoodSources[write++] = mFoodSources[f];
+                }
+                else
+                {
+                    moved[f] = kNotIndexed;
+                    mStaticDirty.Mark(mFoodSources[f].position.x, mFoodSources[f].position.y, kFoodRadius);
                 }
             }
+            mFoodSources.erase(mFoodSources.begin() + write, mFoodSources.end());
+            for (uint32_t &index : mFoodRemap)
+            {
+                if (index != kNotIndexed)
+                    index = moved[index];
+            }
+            mUnindexedFoodBegin = std::min(unindexedBegin, write);
         }
 
         // 📊 MISE À JOUR DES STATISTIQUES
+        // Rien n'est recompté : le recensement est tenu à jour par les événements du tick
         void Ecosystem::UpdateStatistics()
         {
-            mStats.totalHerbivores = 0;
-            mStats.totalCarnivores = 0;
-            mStats.totalPlants = 0;
+            const PopulationCensus &census = mEntities.census;
+            mStats.totalHerbivores = static_cast<int>(census.GetPopulation(EntityType::HERBIVORE));
+            mStats.totalCarnivores = static_cast<int>(census.GetPopulation(EntityType::CARNIVORE));
+            mStats.totalPlants = static_cast<int>(census.GetPopulation(EntityType::PLANT));
             mStats.totalFood = mFoodSources.size();
 
-            for (const auto &entity : mEntities)
+            // Échantillon du tick pour la série temporelle
+            StatisticsSample sample;
+            sample.tick = static_cast<uint64_t>(mDayCycle);
+            for (std::size_t type = 0; type < kSpeciesCount; ++type)
             {
-                switch (entity->GetType())
-                {
-                case EntityType::HERBIVORE:
-                    mStats.totalHerbivores++;
-                    break;
-                case EntityType::CARNIVORE:
-                    mStats.totalCarnivores++;
-                    break;
-                case EntityType::PLANT:
-                    mStats.totalPlants++;
-                    break;
-                }
+                sample.population[type] = census.GetPopulation(static_cast<EntityType>(type));
+                sample.meanEnergy[type] = static_cast<float>(census.GetMeanEnergy(static_cast<EntityType>(type)));
             }
+            sample.births = mTickEvents.births;
+            sample.deaths = mTickEvents.deaths;
+            sample.meals = mTickEvents.meals;
+            sample.food = static_cast<uint32_t>(mFoodSources.size());
+            mSeries.Push(sample);
+        }
+
+        Ecosystem::Statistics Ecosystem::GetStatistics() const
+        {
+            // Les totaux sont lus dans le recensement : justes même au milieu d'un tick
+            Statistics stats = mStats;
+            stats.totalHerbivores = static_cast<int>(mEntities.census.GetPopulation(EntityType::HERBIVORE));
+            stats.totalCarnivores = static_cast<int>(mEntities.census.GetPopulation(EntityType::CARNIVORE));
+            stats.totalPlants = static_cast<int>(mEntities.census.GetPopulation(EntityType::PLANT));
+            stats.totalFood = static_cast<int>(mFoodSources.size());
+            return stats;
+        }
+
+        // ⚙ MISE À JOUR PARALLÈLE DES ENTITÉS
+        void Ecosystem::UpdateEntities(float deltaTime)
+        {
+            std::size_t count = mEntities.Size();
+            std::size_t chunks = JobSystem::ChunkCount(count, kChunkSize);
+            ResetChunkBuffers(mChunkDeaths, chunks);
+            mChunkEnergy.assign(chunks, EnergyLedger());
+
+            // Régions actives d'après les positions de départ du tick
+            mLod.MarkActivity(mEntities, mEntityGrid);
+
+            mJobs.ParallelFor(count, kChunkSize, [this, deltaTime](std::size_t chunk, std::size_t begin, std::size_t end)
+                              {
+                                  // Qui est mis à jour, puis passe scalaire des tirages, puis noyau vectoriel sur tout le bloc
+                                  mLod.Schedule(mEntities, mEntityGrid, begin, end);
+                                  EntityKernel::ApplyWander(mEntities, begin, end);
+                                  mChunkEnergy[chunk] = EntityKernel::Integrate(mEntities, begin, end, deltaTime, mChunkDeaths[chunk]).energy; });
+
+            // Fusion des morts dans l'ordre des blocs, et des écarts d'énergie dans le recensement
+            for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                mDeadEntities.insert(mDeadEntities.end(), mChunkDeaths[chunk].begin(), mChunkDeaths[chunk].end());
+                mEntities.census.Apply(mChunkEnergy[chunk]);
+            }
+        }
+
+        // 🗺 RECONSTRUCTION DES INDEX SPATIAUX
+        void Ecosystem::RebuildSpatialIndex()
+        {
+            mEntityGrid.Build(mEntities.positionX, mEntities.positionY, mEntities.Size());
+            mFoodGrid.Build(mFoodSources);
+
+            // Correspondances pour le rendu : tout est indexé, à sa place actuelle
+            mEntityRemap.resize(mEntities.Size());
+            std::iota(mEntityRemap.begin(), mEntityRemap.end(), 0u);
+            mEntityItem.assign(mEntityRemap.begin(), mEntityRemap.end());
+            mUnindexedEntities.clear();
+            mFoodRemap.resize(mFoodSources.size());
+            std::iota(mFoodRemap.begin(), mFoodRemap.end(), 0u);
+            mUnindexedFoodBegin = mFoodSources.size();
+        }
+
+        // 🧭 PILOTAGE : chercher à manger, fuir les prédateurs, éviter les murs
+        void Ecosystem::ApplySteering(float deltaTime)
+        {
+            // Les forces du tick sont rangées dans deux colonnes temporaires, puis intégrées
+            // d'une seule passe par bloc (vitesse += force, vitesse bornée). Chaque entité ne
+            // modifie que sa propre vitesse : les blocs sont indépendants.
+            std::size_t count = mEntities.Size();
+            float *forceX = mScratch.Allocate<float>(count);
+            float *forceY = mScratch.Allocate<float>(count);
+            bool walls = mConfig.boundary == BoundaryMode::Reflect;
+
+            mJobs.ParallelFor(count, kChunkSize, [this, deltaTime, forceX, forceY, walls](std::size_t, std::size_t begin, std::size_t end)
+                              {
+                                  for (std::size_t i = begin; i < end; ++i)
+                                  {
+                                      Vector2D force(0, 0);
+                                      if (mEntities.alive[i])
+                                      {
+                                          Entity entity(mEntities, i);
+                                          switch (mEntities.type[i])
+                                          {
+                                          case EntityType::HERBIVORE:
+                                              // Fuir compte plus que manger
+                                              force = entity.SeekFood(mFoodSources, mFoodGrid) + entity.AvoidPredators(mEntityGrid) * 2.0f;
+                                              break;
+                                          case EntityType::CARNIVORE:
+                                              force = entity.SeekPrey(mEntityGrid);
+                                              break;
+                                          case EntityType::PLANT:
+                                              break; // Les plantes ne bougent pas
+                                          }
+                                          if (walls && mEntities.species[mEntities.type[i]].IsMobile())
+                                              force = force + entity.StayInBounds(mConfig.worldWidth, mConfig.worldHeight);
+                                      }
+                                      forceX[i] = force.x;
+                                      forceY[i] = force.y;
+                                  }
+
+                                  EntityKernel::ApplyForces(mEntities, begin, end, forceX + begin, forceY + begin,
+                                                            kSteeringStrength * deltaTime); });
         }
 
         // 🎲 CRÉATION D'ENTITÉ ALÉATOIRE
         void Ecosystem::SpawnRandomEntity(EntityType type)
         {
-            if (mEntities.size() >= mMaxEntities)
+            if (mEntities.Size() >= static_cast<std::size_t>(mConfig.maxEntities))
                 return;
 
-            Vector2D position = GetRandomPosition();
-            std::string name;
+            // Aucun nom fabriqué : il le sera à la demande, d'après l'espèce et l'identifiant
+            OnEntityAdded(mEntities.Add(type, GetRandomPosition()));
+        }
 
-            switch (type)
-            {
-            case EntityType::HERBIVORE:
-                name = "Herbivore_" + std::to_string(mStats.totalHerbivores);
-                break;
-            case EntityType::CARNIVORE:
-                name = "Carnivore_" + std::to_string(mStats.totalCarnivores);
-                break;
-            case EntityType::PLANT:
-                name = "Plant_" + std::to_string(mStats.totalPlants);
-                break;
-            }
+        // ➕ AJOUT MANUEL D'ENTITÉ / DE NOURRITURE
+        Entity Ecosystem::AddEntity(EntityType type, Vector2D position, const std::string &name)
+        {
+            std::size_t index = mEntities.Add(type, position, mEntities.InternLabel(name));
+            OnEntityAdded(index);
+            return Entity(mEntities, index);
+        }
 
-            // Correction: std::make_unique<Entity>
-            mEntities.push_back(std::make_unique<Entity>(type, position, name));
+        void Ecosystem::AddFood(Vector2D position, float energy)
+        {
+            mFoodSources.emplace_back(position, energy);
+            mStaticDirty.Mark(position.x, position.y, kFoodRadius);
         }
 
         // 📍 POSITION ALÉATOIRE
-        Vector2D Ecosystem::GetRandomPosition() const
+        Vector2D Ecosystem::GetRandomPosition()
+        {
+            float x = WorldRandomUnit(RandomStream::SpawnX) * mConfig.worldWidth;
+            float y = WorldRandomUnit(RandomStream::SpawnY) * mConfig.worldHeight;
+            return Vector2D(x, y);
+        }
+
+        // Tirage propre à l'écosystème : chaque appel consomme un numéro de tirage
+        float Ecosystem::WorldRandomUnit(RandomStream stream)
         {
-            // Correction: <float> manquant
-            std::uniform_real_distribution<float> distX(0.0f, mWorldWidth);
-            std::uniform_real_distribution<float> distY(0.0f, mWorldHeight);
-            return Vector2D(distX(mRandomGenerator), distY(mRandomGenerator));
+            return mEntities.random.Uniform01(RandomService::kWorldKey, mWorldDraws++, stream);
         }
 
         // 🌱 CROISSANCE DES PLANTES
         void Ecosystem::HandlePlantGrowth(float deltaTime)
         {
             // Occasionnellement, faire pousser de nouvelles plantes
-            std::uniform_real_distribution<float> chance(0.0f, 1.0f);
-            if (chance(mRandomGenerator) < 0.01f && mEntities.size() < mMaxEntities)
+            if (WorldRandomUnit(RandomStream::PlantGrowth) < mConfig.plantGrowthChance &&
+                mEntities.Size() < static_cast<std::size_t>(mConfig.maxEntities))
             {
                 SpawnRandomEntity(EntityType::PLANT);
             }
         }
 
+        // 🎨 TEINTE DU DÉCOR
+        // Appelée là où l'énergie d'une entité immobile change (pousse, photosynthèse, broutage,
+        // reproduction) : le rendu n'a jamais à parcourir la population pour trouver quoi retoucher
+        void Ecosystem::TrackStaticTint(std::size_t index)
+        {
+            if (mEntities.species[mEntities.type[index]].IsMobile())
+                return;
+            uint8_t tint = Entity(mEntities, index).GetTintLevel();
+            if (mEntities.staticTint[index] == tint)
+                return;
+            mEntities.staticTint[index] = tint;
+            mStaticDirty.Mark(mEntities.positionX[index], mEntities.positionY[index], mEntities.size[index] / 2.0f);
+        }
+
+        // ➕ SUIVI DES AJOUTS
+        void Ecosystem::OnEntityAdded(std::size_t index)
+        {
+            mEntityItem.push_back(kNotIndexed);
+            mUnindexedEntities.push_back(mEntities.GetHandle(index));
+            TrackStaticTint(index);
+        }
+
         // 🎨 RENDU
-        void Ecosystem::Render(SDL_Renderer *renderer) const
+        // Les entités mobiles sont ajoutées au lot du renderer ; c'est GameEngine qui
+        // l'envoie à SDL (Flush). Le décor immobile est dans la couche statique.
+        void Ecosystem::Render(Graphics::Renderer &renderer, Graphics::StaticLayer &staticLayer,
+                               const Graphics::Camera &camera, float alpha)
         {
-            // Rendu de la nourriture (petits carrés verts)
-            for (const auto &food : mFoodSources)
+            Graphics::Renderer::View previousView = renderer.GetView();
+            renderer.SetView(camera.GetView());
+
+            // Zone visible, élargie de la plus grande entité (carré, barre d'énergie au-dessus,
+            // et quelques pixels pour l'interpolation depuis la position du tick précédent)
+            float margin = 0.0f;
+            for (const SpeciesTraits &traits : mEntities.species.traits)
+                margin = std::max(margin, traits.size);
+            margin += 8.0f;
+            float left = camera.GetVisibleLeft() - margin;
+            float top = camera.GetVisibleTop() - margin;
+            float right = camera.GetVisibleRight() + margin;
+            float bottom = camera.GetVisibleBottom() + margin;
+
+            // Texture neuve (premier rendu, renderer recréé...) : tout est à dessiner
+            if (staticLayer.Prepare(renderer.GetSDLRenderer(), mConfig.worldWidth, mConfig.worldHeight))
+                mStaticDirty.MarkAll();
+
+            // 1) Décor : la couche statique, retouchée sur les tuiles marquées. Sans couche, ou
+            //    si elle est réduite et serait agrandie à l'écran (floue), le décor visible est
+            //    dessiné directement ; les marques attendent le retour à la couche.
+            bool cached = staticLayer.IsReady() &&
+                          (staticLayer.GetScale() >= 1.0f || camera.GetScale() <= staticLayer.GetScale());
+            if (cached)
             {
-                SDL_FRect rect = {
-                    food.position.x - 3.0f,
-                    food.position.y - 3.0f,
-                    6.0f,
-                    6.0f};
-                // Correction: Ajout du canal Alpha (255)
-                SDL_SetRenderDrawColor(renderer, food.color.r, food.color.g, food.color.b, 255);
-                SDL_RenderFillRect(renderer, &rect);
+                if (!mStaticDirty.IsEmpty())
+                {
+                    staticLayer.BeginPatch(renderer, mStaticDirty);
+                    // Ce qui déborde sur une tuile marquée est cherché dans les grilles autour
+                    // d'elle. Un objet à cheval sur deux tuiles est redessiné deux fois à
+                    // l'identique : sans mélange, c'est sans effet. La nourriture d'abord,
+                    // les plantes ensuite, comme au premier dessin.
+                    float reach = 0.0f;
+                    for (const SpeciesTraits &traits : mEntities.species.traits)
+                    {
+                        if (!traits.IsMobile())
+                            reach = std::max(reach, traits.size / 2.0f);
+                    }
+                    mStaticDirty.ForEachDirtyTile([this, &renderer](int x, int y, int width, int height)
+                                                  {
+                                                      ForEachFoodInRect(x - kFoodRadius, y - kFoodRadius, x + width + kFoodRadius,
+                                                                        y + height + kFoodRadius, [this, &renderer](std::size_t f)
+                                                                        {
+                                                                            const Food &food = mFoodSources[f];
+                                                                            renderer.FillRect(food.position.x - kFoodRadius, food.position.y - kFoodRadius,
+                                                                                              kFoodRadius * 2.0f, kFoodRadius * 2.0f, food.color); }); });
+                    mStaticDirty.ForEachDirtyTile([this, &renderer, reach, alpha](int x, int y, int width, int height)
+                                                  {
+                                                      ForEachEntityInRect(x - reach, y - reach, x + width + reach, y + height + reach,
+                                                                          [this, &renderer, alpha](std::size_t i)
+                                                                          {
+                                                                              if (mEntities.alive[i] && !mEntities.species[mEntities.type[i]].IsMobile())
+                                                                                  Entity(mEntities, i).Render(renderer, alpha); }); });
+                    staticLayer.EndPatch(renderer);
+                    mStaticDirty.Clear();
+                }
+                staticLayer.Draw(renderer);
+            }
+            else
+            {
+                ForEachFoodInRect(left, top, right, bottom, [this, &renderer](std::size_t f)
+                                  {
+                                      const Food &food = mFoodSources[f];
+                                      renderer.FillRect(food.position.x - kFoodRadius, food.position.y - kFoodRadius,
+                                                        kFoodRadius * 2.0f, kFoodRadius * 2.0f, food.color); });
+                ForEachEntityInRect(left, top, right, bottom, [this, &renderer, alpha](std::size_t i)
+                                    {
+                                        if (!mEntities.species[mEntities.type[i]].IsMobile())
+                                            Entity(mEntities, i).Render(renderer, alpha); });
             }
 
-            // Rendu des entités
-            for (const auto &entity : mEntities)
+            // 2) Entités mobiles visibles, par-dessus (de loin : tuiles de densité)
+            if (camera.GetScale() < kHeatmapScale)
             {
-                entity->Render(renderer);
+                RenderHeatmap(renderer, camera);
+            }
+            else
+            {
+                ForEachEntityInRect(left, top, right, bottom, [this, &renderer, alpha](std::size_t i)
+                                    {
+                                        if (mEntities.species[mEntities.type[i]].IsMobile())
+                                            Entity(mEntities, i).Render(renderer, alpha); });
+            }
+
+            renderer.SetView(previousView);
+        }
+
+        // 🌡 TUILES DE DENSITÉ
+        // Les entités mobiles visibles sont comptées par tuile de kHeatmapTilePixels pixels
+        // d'écran et par espèce. Chaque tuile occupée devient un seul rectangle, de la couleur
+        // moyenne de ses occupants, d'autant plus opaque qu'ils sont nombreux. Les tuiles sont
+        // alignées sur le monde : elles ne glissent pas quand la vue se déplace.
+        void Ecosystem::RenderHeatmap(Graphics::Renderer &renderer, const Graphics::Camera &camera)
+        {
+            float tileSize = kHeatmapTilePixels / camera.GetScale();
+            float left = std::max(camera.GetVisibleLeft(), 0.0f);
+            float top = std::max(camera.GetVisibleTop(), 0.0f);
+            float right = std::min(camera.GetVisibleRight(), mConfig.worldWidth);
+            float bottom = std::min(camera.GetVisibleBottom(), mConfig.worldHeight);
+            if (right < left || bottom < top)
+                return;
+
+            int firstColumn = static_cast<int>(left / tileSize);
+            int firstRow = static_cast<int>(top / tileSize);
+            int columns = static_cast<int>(right / tileSize) - firstColumn + 1;
+            int rows = static_cast<int>(bottom / tileSize) - firstRow + 1;
+
+            // assign garde la capacité : pas d'allocation tant que la fenêtre ne grandit pas
+            mHeatmap.assign(static_cast<std::size_t>(columns) * rows * kSpeciesCount, 0);
+            ForEachEntityInRect(left, top, right, bottom, [&](std::size_t i)
+                                {
+                                    if (!mEntities.alive[i] || !mEntities.species[mEntities.type[i]].IsMobile())
+                                        return;
+                                    int column = std::min(std::max(static_cast<int>(mEntities.positionX[i] / tileSize) - firstColumn, 0), columns - 1);
+                                    int row = std::min(std::max(static_cast<int>(mEntities.positionY[i] / tileSize) - firstRow, 0), rows - 1);
+                                    std::size_t tile = static_cast<std::size_t>(row) * columns + column;
+                                    mHeatmap[tile * kSpeciesCount + static_cast<std::size_t>(mEntities.type[i])]++; });
+
+            for (int row = 0; row < rows; ++row)
+            {
+                for (int column = 0; column < columns; ++column)
+                {
+                    const uint32_t *counts = &mHeatmap[(static_cast<std::size_t>(row) * columns + column) * kSpeciesCount];
+                    uint32_t total = 0;
+                    float red = 0.0f, green = 0.0f, blue = 0.0f;
+                    for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                    {
+                        const Color &color = mEntities.species.traits[t].color;
+                        total += counts[t];
+                        red += color.r * static_cast<float>(counts[t]);
+                        green += color.g * static_cast<float>(counts[t]);
+                        blue += color.b * static_cast<float>(counts[t]);
+                    }
+                    if (total == 0)
+                        continue;
+
+                    uint8_t opacity = static_cast<uint8_t>(std::min(96u + 32u * total, 255u));
+                    Color color(static_cast<uint8_t>(red / total), static_cast<uint8_t>(green / total),
+                                static_cast<uint8_t>(blue / total), opacity);
+                    renderer.FillRect((firstColumn + column) * tileSize, (firstRow + row) * tileSize, tileSize, tileSize, color);
+                }
             }
         }
 
@@ -1,5 +1,7 @@
-#include "../Core/Entity.h"
-#include <iostream>
+#include "Core/Entity.h"
+#include "Core/EntityKernel.h"
+#include "Core/LodScheduler.h"
+#include "Core/Logger.h"
 #include <algorithm>
 #include <cmath>
 
@@ -8,194 +10,87 @@ namespace Ecosystem
     namespace Core
     {
 
-        // 🏗 CONSTRUCTEUR PRINCIPAL
-        Entity::Entity(EntityType type, Vector2D pos, std::string entityName)
-            : mType(type), position(pos), name(entityName),
-              mRandomGenerator(std::random_device{}()) // Initialisation du générateur aléatoire
+        // 👀 RAYONS DE PERCEPTION (en pixels)
+        namespace
         {
-            // INITIALISATION SELON LE TYPE
-            switch (mType)
-            {
-            case EntityType::HERBIVORE:
-                mEnergy = 80.0f;
-                mMaxEnergy = 150.0f;
-                mMaxAge = 200;
-                color = Color::Blue();
-                size = 8.0f;
-                break;
-            case EntityType::CARNIVORE:
-                mEnergy = 100.0f;
-                mMaxEnergy = 200.0f;
-                mMaxAge = 150;
-                color = Color::Red();
-                size = 12.0f;
-                break;
-            case EntityType::PLANT:
-                mEnergy = 50.0f;
-                mMaxEnergy = 100.0f;
-                mMaxAge = 300;
-                color = Color::Green();
-                size = 6.0f;
-                break;
-            }
-
-            mAge = 0;
-            mIsAlive = true;
-            mVelocity = GenerateRandomDirection();
-
-            // Correction de la ligne coupée
-            std::cout << "🌱 Entité créée: " << name << " à (" << position.x << ", " << position.y << ")" << std::endl;
-        }
-
-        // 🏗 CONSTRUCTEUR DE COPIE
-        Entity::Entity(const Entity &other)
-            : mType(other.mType), position(other.position), name(other.name + "_copy"),
-              mEnergy(other.mEnergy * 0.7f), // Enfant a moins d'énergie
-              mMaxEnergy(other.mMaxEnergy),
-              mAge(0), // Nouvelle entité, âge remis à 0
-              mMaxAge(other.mMaxAge),
-              mIsAlive(true),
-              mVelocity(other.mVelocity),
-              color(other.color),
-              size(other.size * 0.8f), // Enfant plus petit
-              mRandomGenerator(std::random_device{}())
-        {
-            // Correction : Le cout doit être DANS les accolades
-            std::cout << "👶 Copie d'entité créée: " << name << std::endl;
+            constexpr float kFoodPerceptionRadius = 80.0f;
+            constexpr float kPreyPerceptionRadius = 100.0f;
+            constexpr float kPredatorPerceptionRadius = 60.0f;
+            constexpr float kBoundsMargin = 40.0f; // Distance au bord où l'on commence à tourner
         }
 
-        // 🗑 DESTRUCTEUR
-        Entity::~Entity()
-        {
-            // Correction de la ligne coupée
-            std::cout << "💀 Entité détruite: " << name << " (Age: " << mAge << ")" << std::endl;
-        }
-
-        // ⚙ MISE À JOUR PRINCIPALE
-        void Entity::Update(float deltaTime)
-        {
-            if (!mIsAlive)
-                return;
-
-            // PROCESSUS DE VIE
-            ConsumeEnergy(deltaTime);
-            Age(deltaTime);
-            Move(deltaTime);
-            CheckVitality();
-        }
-
-        // 🏃 MOUVEMENT
-        void Entity::Move(float deltaTime)
+        // 🍽 MANGER
+        void Entity::Eat(float energy, EnergyLedger *ledger)
         {
-            if (mType == EntityType::PLANT)
-                return; // Les plantes ne bougent pas
-
-            // Comportement aléatoire occasionnel
-            // Correction : Ajout de <float> manquant
-            std::uniform_real_distribution<float> chance(0.0f, 1.0f);
-
-            if (chance(mRandomGenerator) < 0.02f)
+            float before = mStore->energy[mIndex];
+            float current = before + energy;
+            if (current > mStore->maxEnergy[mIndex])
             {
-                mVelocity = GenerateRandomDirection();
+                current = mStore->maxEnergy[mIndex];
             }
-
-            // Application du mouvement
-            position = position + mVelocity * deltaTime * 20.0f;
-
-            // Consommation d'énergie due au mouvement
-            mEnergy -= mVelocity.Distance(Vector2D(0, 0)) * deltaTime * 0.1f;
-        }
-
-        // 🍽 MANGER
-        void Entity::Eat(float energy)
-        {
-            mEnergy += energy;
-            if (mEnergy > mMaxEnergy)
+            if (ledger)
             {
-                mEnergy = mMaxEnergy;
+                ledger->Record(mStore->type[mIndex], before, current);
+                mStore->energy[mIndex] = current;
             }
-            std::cout << "🍽 " << name << " mange et gagne " << energy << " énergie" << std::endl;
-        }
-
-        // 🔋 CONSOMMATION D'ÉNERGIE
-        void Entity::ConsumeEnergy(float deltaTime)
-        {
-            float baseConsumption = 0.0f;
-            switch (mType)
+            else
             {
-            case EntityType::HERBIVORE:
-                baseConsumption = 1.5f;
-                break;
-            case EntityType::CARNIVORE:
-                baseConsumption = 2.0f;
-                break;
-            case EntityType::PLANT:
-                baseConsumption = -0.5f; // Les plantes génèrent de l'énergie !
-                break;
+                mStore->SetEnergy(mIndex, current);
             }
-            mEnergy -= baseConsumption * deltaTime;
+            ECO_LOG_TRACE("🍽 %s mange et gagne %g énergie", GetName().c_str(), energy);
         }
 
-        // ⏳ VIEILLISSEMENT
-        void Entity::Age(float deltaTime)
+        // ❤ REPRODUCTION
+        bool Entity::CanReproduce() const
         {
-            // Correction : static_cast<int>
-            mAge += static_cast<int>(deltaTime * 10.0f); // Accéléré pour la simulation
+            return IsAlive() && GetEnergy() > mStore->maxEnergy[mIndex] * 0.8f && GetAge() > 20;
         }
 
-        // ❤ VÉRIFICATION DE LA SANTÉ
-        void Entity::CheckVitality()
+        bool Entity::Reproduce()
         {
-            if (mEnergy <= 0.0f || mAge >= mMaxAge)
-            {
-                mIsAlive = false;
-                std::cout << "💀 " << name << " meurt - ";
-                if (mEnergy <= 0)
-                    std::cout << "Faim";
-                else
-                    std::cout << "Vieillesse";
-                std::cout << std::endl;
-            }
+            if (!WantsToReproduce())
+                return false;
+
+            PayReproductionCost();
+            return true;
         }
 
-        // ❤ REPRODUCTION
-        bool Entity::CanReproduce() const
+        bool Entity::WantsToReproduce() const
         {
-            return mIsAlive && mEnergy > mMaxEnergy * 0.8f && mAge > 20;
+            // Chance de reproduction par tick ; une entité au repos (voir LodScheduler) tente
+            // sa chance quand elle est mise à jour, pour tous les ticks écoulés d'un coup
+            uint8_t steps = mStore->updateSteps[mIndex];
+            if (steps == 0)
+                return false;
+            float chance = steps == 1 ? 0.3f : LodScheduler::CombinedChance(0.3f, steps);
+            return CanReproduce() && mStore->RandomUnit(mIndex, RandomStream::ReproductionChance) < chance;
         }
 
-        std::unique_ptr<Entity> Entity::Reproduce()
+        void Entity::PayReproductionCost()
         {
-            if (!CanReproduce())
-                return nullptr;
-
-            // Chance de reproduction
-            std::uniform_real_distribution<float> chance(0.0f, 1.0f);
-            if (chance(mRandomGenerator) < 0.3f)
-            {
-                mEnergy *= 0.6f; // Coût énergétique de la reproduction
-                // Correction : std::make_unique<Entity>
-                return std::make_unique<Entity>(*this); // Utilise le constructeur de copie
-            }
-            return nullptr;
+            mStore->SetEnergy(mIndex, mStore->energy[mIndex] * 0.6f); // Coût énergétique de la reproduction
         }
 
-        // 🎲 GÉNÉRATION DE DIRECTION ALÉATOIRE
-        Vector2D Entity::GenerateRandomDirection()
+        // 🎨 CALCUL DE LA COULEUR BASÉE SUR L'ÉTAT
+        uint8_t Entity::GetTintLevel() const
         {
-            std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
-            return Vector2D(dist(mRandomGenerator), dist(mRandomGenerator));
+            float energyRatio = GetEnergyPercentage();
+            if (!(energyRatio < kLowEnergyRatio))
+                return 0;
+            // Tranche de [0, kLowEnergyRatio[ où se trouve l'énergie (0 = la plus basse)
+            int slice = static_cast<int>(std::max(energyRatio, 0.0f) / kLowEnergyRatio * kLowEnergyTints);
+            return static_cast<uint8_t>(kLowEnergyTints - std::min(slice, kLowEnergyTints - 1));
         }
 
-        // 🎨 CALCUL DE LA COULEUR BASÉE SUR L'ÉTAT
         Color Entity::CalculateColorBasedOnState() const
         {
-            float energyRatio = GetEnergyPercentage();
-            Color baseColor = color;
+            Color baseColor = GetColor();
 
-            // Rouge si faible énergie
-            if (energyRatio < 0.3f)
+            // Rouge si faible énergie, assombri selon le palier (bas de sa tranche d'énergie)
+            uint8_t tint = GetTintLevel();
+            if (tint != 0)
             {
+                float energyRatio = static_cast<float>(kLowEnergyTints - tint) / kLowEnergyTints * kLowEnergyRatio;
                 baseColor.r = 255;
                 // Correction : static_cast<uint8_t> car ce sont des entiers 8 bits
                 baseColor.g = static_cast<uint8_t>(baseColor.g * energyRatio);
@@ -205,56 +100,104 @@ namespace Ecosystem
         }
 
         // 🖌 RENDU GRAPHIQUE
-        void Entity::Render(SDL_Renderer *renderer) const
+        // Les rectangles sont ajoutés au lot du Renderer (aucun appel SDL ici)
+        void Entity::Render(Graphics::Renderer &renderer, float alpha) const
         {
-            if (!mIsAlive)
+            if (!IsAlive())
                 return;
 
             Color renderColor = CalculateColorBasedOnState();
 
-            // SDL_FRect est utilisé dans SDL3 (Float Rect)
-            SDL_FRect rect = {
-                position.x - size / 2.0f,
-                position.y - size / 2.0f,
-                size,
-                size};
+            // Interpolation entre la position du tick précédent et la position actuelle
+            float previousX = mStore->previousPositionX[mIndex];
+            float previousY = mStore->previousPositionY[mIndex];
+            Vector2D position(previousX + (mStore->positionX[mIndex] - previousX) * alpha,
+                              previousY + (mStore->positionY[mIndex] - previousY) * alpha);
+            float size = GetSize();
+            renderer.FillRect(position.x - size / 2.0f, position.y - size / 2.0f, size, size, renderColor);
 
-            // Correction des arguments manquants (alpha channel)
-            SDL_SetRenderDrawColor(renderer, renderColor.r, renderColor.g, renderColor.b, renderColor.a);
-            SDL_RenderFillRect(renderer, &rect);
-
-            // Indicateur d'énergie (barre de vie)
-            if (mType != EntityType::PLANT)
+            // Indicateur d'énergie (barre de vie), pour les espèces mobiles
+            if (mStore->species[GetType()].IsMobile())
             {
                 float energyBarWidth = size * GetEnergyPercentage();
-                SDL_FRect energyBar = {
-                    position.x - size / 2.0f,
-                    position.y - size / 2.0f - 3.0f,
-                    energyBarWidth,
-                    2.0f};
-                SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
-                SDL_RenderFillRect(renderer, &energyBar);
+                renderer.FillRect(position.x - size / 2.0f, position.y - size / 2.0f - 3.0f,
+                                  energyBarWidth, 2.0f, Color::Green());
             }
         }
 
-        // Ces fonctions étaient dans le .hpp mais pas dans le texte fourni.
+        // 🧭 DIRECTION VERS LA NOURRITURE LA PLUS PROCHE
+        Vector2D Entity::SeekFood(const std::vector<Food> &foodSources, const SpatialGrid &foodGrid) const
+        {
+            Vector2D position = GetPosition();
+            long nearest = foodGrid.FindNearest(position, kFoodPerceptionRadius,
+                                                [](std::size_t)
+                                                { return true; });
+            if (nearest < 0)
+                return Vector2D(0, 0); // Rien à l'horizon
+
+            return (foodSources[nearest].position - position).Normalized();
+        }
+
+        // 🎯 DIRECTION VERS LA PROIE LA PLUS PROCHE (carnivores)
+        Vector2D Entity::SeekPrey(const SpatialGrid &entityGrid) const
+        {
+            const EntityStore &store = *mStore;
+            Vector2D position = GetPosition();
+            long nearest = entityGrid.FindNearest(position, kPreyPerceptionRadius,
+                                                  [&store](std::size_t other)
+                                                  {
+                                                      return store.alive[other] && store.type[other] == EntityType::HERBIVORE;
+                                                  });
+            if (nearest < 0)
+                return Vector2D(0, 0);
+
+            return (Vector2D(store.positionX[nearest], store.positionY[nearest]) - position).Normalized();
+        }
 
-        Vector2D Entity::SeekFood(const std::vector<Food> &foodSources) const
+        // 🏃 FUITE DEVANT LES PRÉDATEURS PROCHES
+        Vector2D Entity::AvoidPredators(const SpatialGrid &entityGrid) const
         {
-            // TODO: Parcourir la liste foodSources, trouver la plus proche et retourner le vecteur direction
-            return Vector2D(0, 0); // Pour l'instant, ne fait rien
+            const EntityStore &store = *mStore;
+            Vector2D position = GetPosition();
+            Vector2D flee(0, 0);
+
+            // Chaque carnivore visible "repousse" l'entité, d'autant plus qu'il est proche
+            entityGrid.ForEachInRadius(position, kPredatorPerceptionRadius,
+                                       [&](std::size_t other, float distanceSquared)
+                                       {
+                                           if (!store.alive[other] || store.type[other] != EntityType::CARNIVORE)
+                                               return;
+                                           Vector2D away = position - Vector2D(store.positionX[other], store.positionY[other]);
+                                           float distance = std::sqrt(distanceSquared);
+                                           if (distance > 0.0f)
+                                               flee = flee + away * (1.0f / (distance * distance) * kPredatorPerceptionRadius);
+                                       });
+            return flee.Normalized();
         }
 
-        Vector2D Entity::AvoidPredators(const std::vector<Entity> &predators) const
+        // ➕ APPLICATION D'UNE FORCE DE PILOTAGE
+        // Même intégration que la passe par lots d'Ecosystem::ApplySteering
+        void Entity::ApplyForce(Vector2D force)
         {
-            // TODO: Détecter les prédateurs proches et fuir
-            return Vector2D(0, 0);
+            EntityKernel::ApplyForces(*mStore, mIndex, mIndex + 1, &force.x, &force.y, 1.0f);
         }
 
+        // 🧱 DEMI-TOUR À L'APPROCHE D'UN MUR
+        // Nulle loin des bords, elle grandit jusqu'à 1 par axe au contact du mur ; le noyau
+        // fait de toute façon rebondir celles qui le franchissent.
         Vector2D Entity::StayInBounds(float worldWidth, float worldHeight) const
         {
-            // TODO: Si position.x < 0, renvoyer une force vers la droite, etc.
-            return Vector2D(0, 0);
+            Vector2D position = GetPosition();
+            Vector2D force(0, 0);
+            if (position.x < kBoundsMargin)
+                force.x = (kBoundsMargin - position.x) / kBoundsMargin;
+            else if (position.x > worldWidth - kBoundsMargin)
+                force.x = (worldWidth - kBoundsMargin - position.x) / kBoundsMargin;
+            if (position.y < kBoundsMargin)
+                force.y = (kBoundsMargin - position.y) / kBoundsMargin;
+            else if (position.y > worldHeight - kBoundsMargin)
+                force.y = (worldHeight - kBoundsMargin - position.y) / kBoundsMargin;
+            return force;
         }
 
     } // namespace Core
@@ -0,0 +1,516 @@
+#include "Core/EntityKernel.h"
+#include "Core/Logger.h"
+#include <algorithm> // Pour std::min, std::max
+#include <atomic>
+#include <cmath>
+#include <cstring> // Pour std::memcpy
+
+// 🧩 JEUX D'INSTRUCTIONS DISPONIBLES À LA COMPILATION
+// SSE2 fait partie de tout processeur x86-64. AVX2 est compilé à part (attribut "target")
+// et choisi à l'exécution seulement si le processeur le gère.
+#if defined(__SSE2__) || defined(_M_X64)
+#define ECOSYSTEM_KERNEL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ECOSYSTEM_KERNEL_AVX2 1
+#define ECOSYSTEM_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#define ECOSYSTEM_KERNEL_AVX2 1
+#define ECOSYSTEM_TARGET_AVX2
+#include <immintrin.h>
+#endif
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 📋 CONSTANTES DU PAS DE SIMULATION
+        namespace
+        {
+            constexpr float kAgingRate = 10.0f;    // Vieillissement accéléré pour la simulation
+            constexpr float kWanderChance = 0.02f; // Probabilité de changer de direction par tick
+
+            // 🧬 COLONNES DE LA TABLE DES ESPÈCES
+            // Les trois constantes lues par le noyau, rangées par type : 8 flottants par
+            // colonne, soit un registre AVX2 (le type sert directement d'index de permutation).
+            // Une espèce immobile a moveScale = moveCost = 0 : son mouvement ajoute 0 à sa
+            // position et retire 0 à son énergie, sans test sur le type.
+            struct SpeciesColumns
+            {
+                alignas(32) float metabolism[kMaxSpecies] = {};
+                alignas(32) float moveScale[kMaxSpecies] = {};
+                alignas(32) float moveCost[kMaxSpecies] = {};
+
+                explicit SpeciesColumns(const SpeciesTable &species)
+                {
+                    for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                    {
+                        metabolism[t] = species.traits[t].metabolism;
+                        moveScale[t] = species.traits[t].moveScale;
+                        moveCost[t] = species.traits[t].moveCost;
+                    }
+                }
+            };
+
+            using InstructionSet = EntityKernel::InstructionSet;
+
+            bool IsSupported(InstructionSet instructionSet)
+            {
+                switch (instructionSet)
+                {
+                case InstructionSet::AVX2:
+#if defined(ECOSYSTEM_KERNEL_AVX2) && (defined(__GNUC__) || defined(__clang__))
+                    __builtin_cpu_init(); // Nécessaire : appelé pendant l'initialisation des globales
+                    return __builtin_cpu_supports("avx2");
+#elif defined(ECOSYSTEM_KERNEL_AVX2)
+                    return true;
+#else
+                    return false;
+#endif
+                case InstructionSet::SSE2:
+#if defined(ECOSYSTEM_KERNEL_SSE2)
+                    return true;
+#else
+                    return false;
+#endif
+                case InstructionSet::Scalar:
+                    return true;
+                }
+                return false;
+            }
+
+            InstructionSet DetectInstructionSet()
+            {
+                if (IsSupported(InstructionSet::AVX2))
+                    return InstructionSet::AVX2;
+                if (IsSupported(InstructionSet::SSE2))
+                    return InstructionSet::SSE2;
+                return InstructionSet::Scalar;
+            }
+
+            std::atomic<int> gInstructionSet(static_cast<int>(DetectInstructionSet()));
+
+            // 💀 Enregistrement d'une mort repérée par le masque
+            void RecordDeath(EntityStore &store, std::size_t index, bool hunger,
+                             EntityKernel::Summary &counts, std::vector<std::size_t> &deaths)
+            {
+                store.alive[index] = 0;
+                deaths.push_back(index);
+                if (hunger)
+                    counts.hunger++;
+                else
+                    counts.age++;
+                ECO_LOG_TRACE("💀 %s meurt - %s", store.FormatName(index).c_str(), hunger ? "Faim" : "Vieillesse");
+            }
+
+            // 🧱 RETOUR DANS LE MONDE
+            // Rare (seules les entités qui viennent de franchir un bord) : même code scalaire
+            // pour toutes les versions, appliqué aux valeurs déjà écrites par le noyau.
+            // Le résultat est toujours dans [0, extent[, même pour un pas plus long que le
+            // monde (move_scale élevé) ou quand l'arrondi retombe exactement sur extent.
+            void ConstrainAxis(BoundaryMode mode, float extent, float &position, float &velocity, float &previous)
+            {
+                bool below = position < 0.0f;
+                bool above = position >= extent;
+                if (!below && !above)
+                    return;
+
+                float last = std::nextafter(extent, 0.0f); // Plus grande position autorisée
+                if (mode == BoundaryMode::Wrap)
+                {
+                    // fmod est exact : un seul franchissement donne position ± extent, comme avant
+                    float wrapped = std::fmod(position, extent);
+                    if (wrapped < 0.0f)
+                        wrapped = wrapped + extent;
+                    if (wrapped > last)
+                        wrapped = 0.0f; // -0.00001 + extent arrondi à extent : c'est le bord 0
+                    // La position précédente suit le même décalage : l'interpolation du rendu
+                    // ne traverse pas tout l'écran
+                    previous = previous + (wrapped - position);
+                    position = wrapped;
+                }
+                else
+                {
+                    position = below ? 0.0f - position : (extent + extent) - position;
+                    // Pas plus long que le monde : un seul rebond, arrêté contre le mur
+                    position = std::min(std::max(position, 0.0f), last);
+                    velocity = 0.0f - velocity; // Rebond
+                }
+            }
+
+            void Constrain(EntityStore &store, std::size_t index)
+            {
+                const WorldBounds &bounds = store.bounds;
+                ConstrainAxis(bounds.mode, bounds.width, store.positionX[index], store.velocityX[index], store.previousPositionX[index]);
+                ConstrainAxis(bounds.mode, bounds.height, store.positionY[index], store.velocityY[index], store.previousPositionY[index]);
+            }
+
+            // 🐢 UNE ENTITÉ (version scalaire, et fin de plage des versions vectorielles)
+            void IntegrateScalar(EntityStore &store, std::size_t begin, std::size_t end, float deltaTime,
+                                 const SpeciesColumns &species, EntityKernel::Summary &counts,
+                                 std::vector<std::size_t> &deaths)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    if (!store.alive[i] || store.updateSteps[i] == 0)
+                        continue;
+
+                    // Temps écoulé depuis la dernière mise à jour (deltaTime si elle date du tick précédent)
+                    float dt = static_cast<float>(store.updateSteps[i]) * deltaTime;
+                    float ageStep = dt * kAgingRate;
+                    uint8_t type = static_cast<uint8_t>(store.type[i]);
+                    float oldEnergy = store.energy[i];
+                    float energy = oldEnergy - species.metabolism[type] * dt;
+                    float age = store.age[i] + ageStep;
+
+                    float velocityX = store.velocityX[i];
+                    float velocityY = store.velocityY[i];
+                    store.positionX[i] += velocityX * dt * species.moveScale[type];
+                    store.positionY[i] += velocityY * dt * species.moveScale[type];
+                    energy -= std::sqrt(velocityX * velocityX + velocityY * velocityY) * dt * species.moveCost[type];
+                    Constrain(store, i);
+
+                    store.energy[i] = energy;
+                    store.age[i] = age;
+                    counts.energy.Record(store.type[i], oldEnergy, energy);
+
+                    bool hunger = energy <= 0.0f;
+                    if (hunger || age >= static_cast<float>(store.maxAge[i]))
+                        RecordDeath(store, i, hunger, counts, deaths);
+                }
+            }
+
+#if defined(ECOSYSTEM_KERNEL_SSE2)
+            // 🐇 4 ENTITÉS PAR INSTRUCTION (SSE2)
+            inline __m128 Select(__m128 mask, __m128 ifTrue, __m128 ifFalse)
+            {
+                return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+            }
+
+            // 4 octets → 4 entiers 32 bits
+            inline __m128i LoadBytes4(const void *bytes)
+            {
+                int32_t packed;
+                std::memcpy(&packed, bytes, sizeof(packed));
+                __m128i zero = _mm_setzero_si128();
+                __m128i words = _mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero);
+                return _mm_unpacklo_epi16(words, zero);
+            }
+
+            // Une colonne de la table des espèces pour 4 entités (SSE2 n'a pas de permutation variable)
+            inline __m128 LookupSpecies4(const float *column, const EntityType *types)
+            {
+                return _mm_setr_ps(column[static_cast<uint8_t>(types[0])], column[static_cast<uint8_t>(types[1])],
+                                   column[static_cast<uint8_t>(types[2])], column[static_cast<uint8_t>(types[3])]);
+            }
+
+            // Écart d'énergie en entiers (arrondi au plus proche, comme std::lrint), cumulé
+            // en 64 bits dans l'accumulateur de l'espèce de chaque entité
+            inline void AccumulateEnergy4(__m128i *accumulators, __m128i types, __m128 oldEnergy, __m128 energy)
+            {
+                const __m128 scale = _mm_set1_ps(EnergyLedger::kEnergyScale);
+                __m128i delta = _mm_sub_epi32(_mm_cvtps_epi32(_mm_mul_ps(energy, scale)),
+                                              _mm_cvtps_epi32(_mm_mul_ps(oldEnergy, scale)));
+                for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                {
+                    __m128i own = _mm_and_si128(delta, _mm_cmpeq_epi32(types, _mm_set1_epi32(static_cast<int>(t))));
+                    __m128i sign = _mm_srai_epi32(own, 31);
+                    accumulators[t] = _mm_add_epi64(accumulators[t], _mm_unpacklo_epi32(own, sign));
+                    accumulators[t] = _mm_add_epi64(accumulators[t], _mm_unpackhi_epi32(own, sign));
+                }
+            }
+
+            std::size_t IntegrateSSE2(EntityStore &store, std::size_t begin, std::size_t end, float deltaTime,
+                                      const SpeciesColumns &species, EntityKernel::Summary &counts,
+                                      std::vector<std::size_t> &deaths)
+            {
+                const __m128 deltaTimes = _mm_set1_ps(deltaTime);
+                const __m128 agingRate = _mm_set1_ps(kAgingRate);
+                const __m128 zero = _mm_setzero_ps();
+                const __m128 width = _mm_set1_ps(store.bounds.width);
+                const __m128 height = _mm_set1_ps(store.bounds.height);
+                const __m128i zeroInt = _mm_setzero_si128();
+                __m128i energyDelta[kSpeciesCount];
+                for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                    energyDelta[t] = zeroInt;
+
+                std::size_t i = begin;
+                for (; i + 4 <= end; i += 4)
+                {
+                    // Entités vivantes et mises à jour ce tick (voir LodScheduler)
+                    __m128i steps = LoadBytes4(&store.updateSteps[i]);
+                    __m128 aliveMask = _mm_and_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(LoadBytes4(&store.alive[i]), zeroInt)),
+                                                  _mm_castsi128_ps(_mm_cmpgt_epi32(steps, zeroInt)));
+                    if (_mm_movemask_ps(aliveMask) == 0)
+                        continue;
+                    __m128 dt = _mm_mul_ps(_mm_cvtepi32_ps(steps), deltaTimes);
+                    __m128 ageStep = _mm_mul_ps(dt, agingRate);
+
+                    // Constantes de l'espèce de chaque entité
+                    const EntityType *types = &store.type[i];
+                    __m128 metabolism = LookupSpecies4(species.metabolism, types);
+                    __m128 moveScale = LookupSpecies4(species.moveScale, types);
+                    __m128 moveCost = LookupSpecies4(species.moveCost, types);
+
+                    __m128 oldEnergy = _mm_loadu_ps(&store.energy[i]);
+                    __m128 oldAge = _mm_loadu_ps(&store.age[i]);
+                    __m128 energy = _mm_sub_ps(oldEnergy, _mm_mul_ps(metabolism, dt));
+                    __m128 age = _mm_add_ps(oldAge, ageStep);
+
+                    // Mouvement (nul pour une espèce immobile)
+                    __m128 velocityX = _mm_loadu_ps(&store.velocityX[i]);
+                    __m128 velocityY = _mm_loadu_ps(&store.velocityY[i]);
+                    __m128 positionX = _mm_loadu_ps(&store.positionX[i]);
+                    __m128 positionY = _mm_loadu_ps(&store.positionY[i]);
+                    __m128 movedX = _mm_add_ps(positionX, _mm_mul_ps(_mm_mul_ps(velocityX, dt), moveScale));
+                    __m128 movedY = _mm_add_ps(positionY, _mm_mul_ps(_mm_mul_ps(velocityY, dt), moveScale));
+                    __m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(velocityX, velocityX), _mm_mul_ps(velocityY, velocityY)));
+                    energy = _mm_sub_ps(energy, _mm_mul_ps(_mm_mul_ps(speed, dt), moveCost));
+
+                    _mm_storeu_ps(&store.positionX[i], Select(aliveMask, movedX, positionX));
+                    _mm_storeu_ps(&store.positionY[i], Select(aliveMask, movedY, positionY));
+
+                    // Bords franchis : correction scalaire des seules entités concernées
+                    __m128 outside = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(movedX, zero), _mm_cmpge_ps(movedX, width)),
+                                               _mm_or_ps(_mm_cmplt_ps(movedY, zero), _mm_cmpge_ps(movedY, height)));
+                    int outsideBits = _mm_movemask_ps(_mm_and_ps(outside, aliveMask));
+                    for (int lane = 0; outsideBits != 0 && lane < 4; ++lane)
+                    {
+                        if (outsideBits & (1 << lane))
+                            Constrain(store, i + lane);
+                    }
+                    energy = Select(aliveMask, energy, oldEnergy);
+                    _mm_storeu_ps(&store.energy[i], energy);
+                    AccumulateEnergy4(energyDelta, LoadBytes4(types), oldEnergy, energy);
+                    _mm_storeu_ps(&store.age[i], Select(aliveMask, age, oldAge));
+
+                    // Masque des morts : faim d'abord, sinon vieillesse
+                    __m128 maxAge = _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&store.maxAge[i])));
+                    int hungerBits = _mm_movemask_ps(_mm_and_ps(_mm_cmple_ps(energy, zero), aliveMask));
+                    int ageBits = _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(age, maxAge), aliveMask)) & ~hungerBits;
+                    int deadBits = hungerBits | ageBits;
+                    for (int lane = 0; deadBits != 0 && lane < 4; ++lane)
+                    {
+                        if (deadBits & (1 << lane))
+                            RecordDeath(store, i + lane, (hungerBits >> lane) & 1, counts, deaths);
+                    }
+                }
+
+                for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                {
+                    alignas(16) int64_t lanes[2];
+                    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), energyDelta[t]);
+                    counts.energy.delta[t] += lanes[0] + lanes[1];
+                }
+                return i;
+            }
+#endif
+
+#if defined(ECOSYSTEM_KERNEL_AVX2)
+            // 🚀 8 ENTITÉS PAR INSTRUCTION (AVX2)
+            ECOSYSTEM_TARGET_AVX2
+            std::size_t IntegrateAVX2(EntityStore &store, std::size_t begin, std::size_t end, float deltaTime,
+                                      const SpeciesColumns &species, EntityKernel::Summary &counts,
+                                      std::vector<std::size_t> &deaths)
+            {
+                const __m256 deltaTimes = _mm256_set1_ps(deltaTime);
+                const __m256 agingRate = _mm256_set1_ps(kAgingRate);
+                const __m256 zero = _mm256_setzero_ps();
+                const __m256 width = _mm256_set1_ps(store.bounds.width);
+                const __m256 height = _mm256_set1_ps(store.bounds.height);
+                const __m256i zeroInt = _mm256_setzero_si256();
+                const __m256 metabolismTable = _mm256_load_ps(species.metabolism);
+                const __m256 moveScaleTable = _mm256_load_ps(species.moveScale);
+                const __m256 moveCostTable = _mm256_load_ps(species.moveCost);
+                const __m256 energyScale = _mm256_set1_ps(EnergyLedger::kEnergyScale);
+                __m256i energyDelta[kSpeciesCount];
+                for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                    energyDelta[t] = zeroInt;
+
+                std::size_t i = begin;
+                for (; i + 8 <= end; i += 8)
+                {
+                    __m256i type = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(&store.type[i])));
+                    __m256i alive = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(&store.alive[i])));
+                    __m256i steps = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(&store.updateSteps[i])));
+                    // Entités vivantes et mises à jour ce tick (voir LodScheduler)
+                    __m256 aliveMask = _mm256_castsi256_ps(_mm256_and_si256(_mm256_cmpgt_epi32(alive, zeroInt),
+                                                                            _mm256_cmpgt_epi32(steps, zeroInt)));
+                    if (_mm256_movemask_ps(aliveMask) == 0)
+                        continue;
+                    __m256 dt = _mm256_mul_ps(_mm256_cvtepi32_ps(steps), deltaTimes);
+                    __m256 ageStep = _mm256_mul_ps(dt, agingRate);
+
+                    // Constantes de l'espèce : le type sert d'index dans la table
+                    __m256 metabolism = _mm256_permutevar8x32_ps(metabolismTable, type);
+                    __m256 moveScale = _mm256_permutevar8x32_ps(moveScaleTable, type);
+                    __m256 moveCost = _mm256_permutevar8x32_ps(moveCostTable, type);
+
+                    __m256 oldEnergy = _mm256_loadu_ps(&store.energy[i]);
+                    __m256 oldAge = _mm256_loadu_ps(&store.age[i]);
+                    __m256 energy = _mm256_sub_ps(oldEnergy, _mm256_mul_ps(metabolism, dt));
+                    __m256 age = _mm256_add_ps(oldAge, ageStep);
+
+                    // Mouvement (nul pour une espèce immobile)
+                    __m256 velocityX = _mm256_loadu_ps(&store.velocityX[i]);
+                    __m256 velocityY = _mm256_loadu_ps(&store.velocityY[i]);
+                    __m256 positionX = _mm256_loadu_ps(&store.positionX[i]);
+                    __m256 positionY = _mm256_loadu_ps(&store.positionY[i]);
+                    __m256 movedX = _mm256_add_ps(positionX, _mm256_mul_ps(_mm256_mul_ps(velocityX, dt), moveScale));
+                    __m256 movedY = _mm256_add_ps(positionY, _mm256_mul_ps(_mm256_mul_ps(velocityY, dt), moveScale));
+                    __m256 speed = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(velocityX, velocityX), _mm256_mul_ps(velocityY, velocityY)));
+                    energy = _mm256_sub_ps(energy, _mm256_mul_ps(_mm256_mul_ps(speed, dt), moveCost));
+
+                    _mm256_storeu_ps(&store.positionX[i], _mm256_blendv_ps(positionX, movedX, aliveMask));
+                    _mm256_storeu_ps(&store.positionY[i], _mm256_blendv_ps(positionY, movedY, aliveMask));
+
+                    // Bords franchis : correction scalaire des seules entités concernées
+                    __m256 outside = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(movedX, zero, _CMP_LT_OQ), _mm256_cmp_ps(movedX, width, _CMP_GE_OQ)),
+                                                  _mm256_or_ps(_mm256_cmp_ps(movedY, zero, _CMP_LT_OQ), _mm256_cmp_ps(movedY, height, _CMP_GE_OQ)));
+                    int outsideBits = _mm256_movemask_ps(_mm256_and_ps(outside, aliveMask));
+                    for (int lane = 0; outsideBits != 0 && lane < 8; ++lane)
+                    {
+                        if (outsideBits & (1 << lane))
+                            Constrain(store, i + lane);
+                    }
+                    energy = _mm256_blendv_ps(oldEnergy, energy, aliveMask);
+                    _mm256_storeu_ps(&store.energy[i], energy);
+
+                    // Écart d'énergie en entiers, cumulé en 64 bits par espèce
+                    __m256i delta = _mm256_sub_epi32(_mm256_cvtps_epi32(_mm256_mul_ps(energy, energyScale)),
+                                                     _mm256_cvtps_epi32(_mm256_mul_ps(oldEnergy, energyScale)));
+                    for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                    {
+                        __m256i own = _mm256_and_si256(delta, _mm256_cmpeq_epi32(type, _mm256_set1_epi32(static_cast<int>(t))));
+                        energyDelta[t] = _mm256_add_epi64(energyDelta[t], _mm256_cvtepi32_epi64(_mm256_castsi256_si128(own)));
+                        energyDelta[t] = _mm256_add_epi64(energyDelta[t], _mm256_cvtepi32_epi64(_mm256_extracti128_si256(own, 1)));
+                    }
+                    _mm256_storeu_ps(&store.age[i], _mm256_blendv_ps(oldAge, age, aliveMask));
+
+                    // Masque des morts : faim d'abord, sinon vieillesse
+                    __m256 maxAge = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(&store.maxAge[i])));
+                    int hungerBits = _mm256_movemask_ps(_mm256_and_ps(_mm256_cmp_ps(energy, zero, _CMP_LE_OQ), aliveMask));
+                    int ageBits = _mm256_movemask_ps(_mm256_and_ps(_mm256_cmp_ps(age, maxAge, _CMP_GE_OQ), aliveMask)) & ~hungerBits;
+                    int deadBits = hungerBits | ageBits;
+                    for (int lane = 0; deadBits != 0 && lane < 8; ++lane)
+                    {
+                        if (deadBits & (1 << lane))
+                            RecordDeath(store, i + lane, (hungerBits >> lane) & 1, counts, deaths);
+                    }
+                }
+
+                for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                {
+                    alignas(32) int64_t lanes[4];
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), energyDelta[t]);
+                    counts.energy.delta[t] += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+                }
+                return i;
+            }
+#endif
+        }
+
+        // 🎲 CHANGEMENTS DE DIRECTION ALÉATOIRES
+        void EntityKernel::ApplyWander(EntityStore &store, std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                if (!store.alive[i] || !store.species[store.type[i]].IsMobile())
+                    continue;
+                if (store.RandomUnit(i, RandomStream::WanderChance) < kWanderChance)
+                {
+                    store.velocityX[i] = store.RandomUnit(i, RandomStream::DirectionX) * 2.0f - 1.0f;
+                    store.velocityY[i] = store.RandomUnit(i, RandomStream::DirectionY) * 2.0f - 1.0f;
+                }
+            }
+        }
+
+        // 🧭 INTÉGRATION DES FORCES DE PILOTAGE
+        void EntityKernel::ApplyForces(EntityStore &store, std::size_t begin, std::size_t end,
+                                       const float *forceX, const float *forceY, float gain)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                if (!store.alive[i] || !store.species[store.type[i]].IsMobile())
+                    continue;
+
+                float velocityX = store.velocityX[i] + forceX[i - begin] * gain;
+                float velocityY = store.velocityY[i] + forceY[i - begin] * gain;
+                float speed = std::sqrt(velocityX * velocityX + velocityY * velocityY);
+                if (speed > kMaxSpeed)
+                {
+                    velocityX = velocityX * (kMaxSpeed / speed);
+                    velocityY = velocityY * (kMaxSpeed / speed);
+                }
+                store.velocityX[i] = velocityX;
+                store.velocityY[i] = velocityY;
+            }
+        }
+
+        // ⚙ PAS DE SIMULATION SUR UNE PLAGE
+        EntityKernel::Summary EntityKernel::Integrate(EntityStore &store, std::size_t begin, std::size_t end,
+                                                     float deltaTime, std::vector<std::size_t> &deaths)
+        {
+            Summary counts;
+            std::size_t done = begin;
+            const SpeciesColumns species(store.species);
+
+            switch (GetInstructionSet())
+            {
+#if defined(ECOSYSTEM_KERNEL_AVX2)
+            case InstructionSet::AVX2:
+                done = IntegrateAVX2(store, begin, end, deltaTime, species, counts, deaths);
+                break;
+#endif
+#if defined(ECOSYSTEM_KERNEL_SSE2)
+            case InstructionSet::SSE2:
+                done = IntegrateSSE2(store, begin, end, deltaTime, species, counts, deaths);
+                break;
+#endif
+            default:
+                break;
+            }
+
+            // Fin de plage (moins d'un registre), ou tout en scalaire
+            IntegrateScalar(store, done, end, deltaTime, species, counts, deaths);
+
+            // Un seul ajout aux compteurs par plage
+            if (counts.hunger > 0)
+                Logger::Instance().CountEvent(LifecycleEvent::DiedOfHunger, counts.hunger);
+            if (counts.age > 0)
+                Logger::Instance().CountEvent(LifecycleEvent::DiedOfAge, counts.age);
+            return counts;
+        }
+
+        // 🧩 CHOIX DU JEU D'INSTRUCTIONS
+        EntityKernel::InstructionSet EntityKernel::GetInstructionSet()
+        {
+            return static_cast<InstructionSet>(gInstructionSet.load(std::memory_order_relaxed));
+        }
+
+        void EntityKernel::SetInstructionSet(InstructionSet instructionSet)
+        {
+            if (IsSupported(instructionSet))
+                gInstructionSet.store(static_cast<int>(instructionSet), std::memory_order_relaxed);
+        }
+
+        const char *EntityKernel::GetInstructionSetName(InstructionSet instructionSet)
+        {
+            switch (instructionSet)
+            {
+            case InstructionSet::AVX2:
+                return "avx2";
+            case InstructionSet::SSE2:
+                return "sse2";
+            case InstructionSet::Scalar:
+                return "scalar";
+            }
+            return "?";
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,312 @@
+#include "Core/EntityStore.h"
+#include "Core/Logger.h"
+#include <algorithm>  // Pour std::copy, std::sort
+#include <functional> // Pour std::greater
+#include <utility>    // Pour std::move
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 📦 RÉSERVATION DE LA MÉMOIRE
+        void EntityStore::Reserve(std::size_t capacity)
+        {
+            positionX.reserve(capacity);
+            positionY.reserve(capacity);
+            previousPositionX.reserve(capacity);
+            previousPositionY.reserve(capacity);
+            velocityX.reserve(capacity);
+            velocityY.reserve(capacity);
+            energy.reserve(capacity);
+            age.reserve(capacity);
+            type.reserve(capacity);
+            alive.reserve(capacity);
+            id.reserve(capacity);
+            updateSteps.reserve(capacity);
+            lodDebt.reserve(capacity);
+            maxEnergy.reserve(capacity);
+            maxAge.reserve(capacity);
+            color.reserve(capacity);
+            staticTint.reserve(capacity);
+            size.reserve(capacity);
+            birthTick.reserve(capacity);
+            parentId.reserve(capacity);
+            generation.reserve(capacity);
+            label.reserve(capacity);
+            slot.reserve(capacity);
+            mSlotIndex.reserve(capacity);
+            mSlotGeneration.reserve(capacity);
+            mFreeSlots.reserve(capacity);
+        }
+
+        // 🧹 VIDAGE (la mémoire est conservée pour la simulation suivante)
+        void EntityStore::Clear()
+        {
+            for (std::size_t i = 0; i < mCount; ++i)
+            {
+                ReleaseSlot(i);
+            }
+            mCount = 0;
+            census.Reset(tick);
+        }
+
+        void EntityStore::Resize(std::size_t count)
+        {
+            Clear();
+            Grow(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                AcquireSlot(i);
+            }
+            mCount = count;
+        }
+
+        // 🏷 ÉTIQUETTES
+        uint32_t EntityStore::InternLabel(const std::string &text)
+        {
+            auto found = mLabelIndex.find(text);
+            if (found != mLabelIndex.end())
+                return found->second;
+            uint32_t index = static_cast<uint32_t>(mLabels.size());
+            mLabels.push_back(text);
+            mLabelIndex.emplace(text, index);
+            return index;
+        }
+
+        void EntityStore::SetLabels(std::vector<std::string> labels)
+        {
+            mLabels = std::move(labels);
+            if (mLabels.empty())
+                mLabels.emplace_back();
+            mLabelIndex.clear();
+            for (std::size_t i = 0; i < mLabels.size(); ++i)
+                mLabelIndex.emplace(mLabels[i], static_cast<uint32_t>(i));
+        }
+
+        std::string EntityStore::FormatName(std::size_t index) const
+        {
+            const std::string &text = mLabels[label[index]];
+            std::string result = text.empty() ? std::string(species[type[index]].name) : text;
+            return result.append("_").append(std::to_string(id[index]));
+        }
+
+        // 📊 RECENSEMENT COMPLET
+        void EntityStore::RebuildCensus()
+        {
+            census.Reset(tick);
+            for (std::size_t i = 0; i < mCount; ++i)
+            {
+                census.OnAdded(type[i], energy[i], birthTick[i]);
+            }
+        }
+
+        // 🌱 AJOUT D'UNE ENTITÉ
+        std::size_t EntityStore::Add(EntityType entityType, Vector2D position, uint32_t labelIndex)
+        {
+            std::size_t index = Append();
+
+            type[index] = entityType;
+            positionX[index] = position.x;
+            positionY[index] = position.y;
+            previousPositionX[index] = position.x;
+            previousPositionY[index] = position.y;
+            id[index] = nextId++;
+            parentId[index] = kNoParent;
+            updateSteps[index] = 1;
+            lodDebt[index] = 0;
+            generation[index] = 0;
+            label[index] = labelIndex;
+
+            // INITIALISATION SELON L'ESPÈCE
+            const SpeciesTraits &traits = species[entityType];
+            energy[index] = traits.initialEnergy;
+            maxEnergy[index] = traits.maxEnergy;
+            maxAge[index] = traits.maxAge;
+            color[index] = traits.color;
+            staticTint[index] = kNotPainted;
+            size[index] = traits.size;
+
+            age[index] = 0.0f;
+            alive[index] = 1;
+            birthTick[index] = tick;
+            census.OnAdded(entityType, energy[index], tick);
+
+            // Direction initiale aléatoire
+            velocityX[index] = random.Uniform(id[index], tick, RandomStream::DirectionX, -1.0f, 1.0f);
+            velocityY[index] = random.Uniform(id[index], tick, RandomStream::DirectionY, -1.0f, 1.0f);
+
+            Logger::Instance().CountEvent(LifecycleEvent::Created);
+            ECO_LOG_TRACE("🌱 Entité créée: %s à (%g, %g)", FormatName(index).c_str(), position.x, position.y);
+            return index;
+        }
+
+        // 👶 AJOUT D'UN BÉBÉ
+        std::size_t EntityStore::AddChild(std::size_t parentIndex)
+        {
+            std::size_t index = Append();
+
+            type[index] = type[parentIndex];
+            positionX[index] = positionX[parentIndex];
+            positionY[index] = positionY[parentIndex];
+            previousPositionX[index] = positionX[parentIndex];
+            previousPositionY[index] = positionY[parentIndex];
+            velocityX[index] = velocityX[parentIndex];
+            velocityY[index] = velocityY[parentIndex];
+            energy[index] = energy[parentIndex] * 0.7f; // Enfant a moins d'énergie
+            maxEnergy[index] = maxEnergy[parentIndex];
+            age[index] = 0.0f; // Nouvelle entité, âge remis à 0
+            maxAge[index] = maxAge[parentIndex];
+            alive[index] = 1;
+            color[index] = color[parentIndex];
+            staticTint[index] = kNotPainted;
+            size[index] = size[parentIndex] * 0.8f; // Enfant plus petit
+            id[index] = nextId++;
+            parentId[index] = id[parentIndex]; // Lignée : un entier, pas un nom qui s'allonge
+            generation[index] = generation[parentIndex] + 1;
+            updateSteps[index] = 1;
+            lodDebt[index] = 0;
+            label[index] = label[parentIndex];
+            birthTick[index] = tick;
+            census.OnAdded(type[index], energy[index], tick);
+
+            Logger::Instance().CountEvent(LifecycleEvent::Born);
+            ECO_LOG_TRACE("👶 %s né de %llu (génération %u)", FormatName(index).c_str(),
+                          static_cast<unsigned long long>(parentId[index]), generation[index]);
+            return index;
+        }
+
+        // ⏮ SAUVEGARDE DES POSITIONS PRÉCÉDENTES
+        void EntityStore::SavePreviousPositions()
+        {
+            // Copie contiguë des seules colonnes vivantes
+            std::copy(positionX.begin(), positionX.begin() + mCount, previousPositionX.begin());
+            std::copy(positionY.begin(), positionY.begin() + mCount, previousPositionY.begin());
+        }
+
+        // 💀 SUPPRESSION DES ENTITÉS MORTES
+        std::size_t EntityStore::RemoveDead(std::vector<std::size_t> &deadIndices)
+        {
+            // Du plus grand index au plus petit : quand on traite "dead", tous les morts
+            // situés après lui sont déjà partis, donc la dernière colonne est vivante
+            // (ou est "dead" lui-même)
+            std::sort(deadIndices.begin(), deadIndices.end(), std::greater<std::size_t>());
+
+            std::size_t removed = 0;
+            for (std::size_t dead : deadIndices)
+            {
+                ECO_LOG_TRACE("💀 Entité détruite: %s (Age: %g)", FormatName(dead).c_str(), age[dead]);
+                ReleaseSlot(dead);
+                census.OnRemoved(type[dead], energy[dead], birthTick[dead]);
+
+                std::size_t last = mCount - 1;
+                if (dead != last)
+                {
+                    MoveEntry(last, dead);
+                }
+                mCount = last; // La colonne libérée reste allouée pour les prochaines naissances
+                removed++;
+            }
+            return removed;
+        }
+
+        // 🔀 DÉPLACEMENT D'UNE "COLONNE"
+        void EntityStore::MoveEntry(std::size_t from, std::size_t to)
+        {
+            positionX[to] = positionX[from];
+            positionY[to] = positionY[from];
+            previousPositionX[to] = previousPositionX[from];
+            previousPositionY[to] = previousPositionY[from];
+            velocityX[to] = velocityX[from];
+            velocityY[to] = velocityY[from];
+            energy[to] = energy[from];
+            age[to] = age[from];
+            type[to] = type[from];
+            alive[to] = alive[from];
+            id[to] = id[from];
+            updateSteps[to] = updateSteps[from];
+            lodDebt[to] = lodDebt[from];
+            maxEnergy[to] = maxEnergy[from];
+            maxAge[to] = maxAge[from];
+            color[to] = color[from];
+            staticTint[to] = staticTint[from];
+            size[to] = size[from];
+            birthTick[to] = birthTick[from];
+            parentId[to] = parentId[from];
+            generation[to] = generation[from];
+            label[to] = label[from];
+            slot[to] = slot[from];
+            mSlotIndex[slot[to]] = static_cast<uint32_t>(to);
+        }
+
+        // ➕ NOUVELLE COLONNE EN FIN DE TABLEAUX
+        std::size_t EntityStore::Append()
+        {
+            std::size_t index = mCount;
+            Grow(index + 1);
+            mCount = index + 1;
+            AcquireSlot(index);
+            return index;
+        }
+
+        // 🔖 ATTRIBUTION D'UNE CASE DE POIGNÉE (case libre réutilisée en priorité)
+        void EntityStore::AcquireSlot(std::size_t index)
+        {
+            uint32_t freeSlot;
+            if (!mFreeSlots.empty())
+            {
+                freeSlot = mFreeSlots.back();
+                mFreeSlots.pop_back();
+            }
+            else
+            {
+                freeSlot = static_cast<uint32_t>(mSlotIndex.size());
+                mSlotIndex.push_back(0);
+                mSlotGeneration.push_back(1);
+            }
+            mSlotIndex[freeSlot] = static_cast<uint32_t>(index);
+            slot[index] = freeSlot;
+        }
+
+        // La case est rendue : toutes les poignées qui la désignaient deviennent invalides
+        void EntityStore::ReleaseSlot(std::size_t index)
+        {
+            uint32_t freedSlot = slot[index];
+            uint32_t &generation = mSlotGeneration[freedSlot];
+            generation = generation + 1 == 0 ? 1 : generation + 1; // 0 est réservé à la poignée nulle
+            mFreeSlots.push_back(freedSlot);
+        }
+
+        // 📏 AGRANDISSEMENT DE TOUS LES TABLEAUX (jamais de réduction)
+        void EntityStore::Grow(std::size_t count)
+        {
+            if (count <= type.size())
+                return;
+
+            positionX.resize(count);
+            positionY.resize(count);
+            previousPositionX.resize(count);
+            previousPositionY.resize(count);
+            velocityX.resize(count);
+            velocityY.resize(count);
+            energy.resize(count);
+            age.resize(count);
+            type.resize(count);
+            alive.resize(count);
+            id.resize(count);
+            updateSteps.resize(count);
+            lodDebt.resize(count);
+            maxEnergy.resize(count);
+            maxAge.resize(count);
+            color.resize(count);
+            staticTint.resize(count);
+            size.resize(count);
+            birthTick.resize(count);
+            parentId.resize(count);
+            generation.resize(count);
+            label.resize(count);
+            slot.resize(count);
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -1,20 +1,42 @@
 #include "Core/GameEngine.h"
-#include <iostream>
-#include <thread> // Pour std::this_thread::sleep_for (optionnel mais mieux que SDL_Delay)
+#include "Core/Logger.h"
+#include "Core/Snapshot.h"
+#include <algorithm> // Pour std::min
+#include <cmath>     // Pour std::pow
+#include <cstdio>    // Pour std::snprintf
 
 namespace Ecosystem
 {
     namespace Core
     {
 
+        // 📒 GRAPHIQUE DU PROFILEUR (en pixels)
+        namespace
+        {
+            constexpr float kGraphMargin = 10.0f;
+            constexpr float kGraphHeight = 90.0f;
+            constexpr float kGraphBarWidth = 2.0f;
+            constexpr std::size_t kGraphBars = 200;
+            constexpr float kGraphMsScale = kGraphHeight / 33.3f; // 33 ms = hauteur du graphique
+            constexpr float kFrameBudgetMs = 1000.0f / 60.0f;
+
+            // 🎥 Déplacement de la caméra au clavier : fraction de la fenêtre par appui
+            constexpr float kPanStep = 0.1f;
+        }
+
         // 🏗 CONSTRUCTEUR
-        GameEngine::GameEngine(const std::string &title, float width, float height)
-            : mWindow(title, width, height),
-              mEcosystem(width, height, 500), // Max 500 entités par défaut
+        GameEngine::GameEngine(const std::string &title, const WorldConfig &config)
+            : mWindow(title, config.GetWindowWidth(), config.GetWindowHeight()),
+              mEcosystem(config),
               mIsRunning(false),
               mIsPaused(false),
               mTimeScale(1.0f),
-              mAccumulatedTime(0.0f)
+              mAccumulatedTime(0.0f),
+              mSimulationRate(60.0f),
+              mMaxStepsPerFrame(32),
+              mShowProfiler(false),
+              mLastRenderMs(0.0f),
+              mSnapshotPath("ecosystem.snap")
         {
         }
 
@@ -25,21 +47,36 @@ namespace Ecosystem
             {
                 return false;
             }
+            mRenderer.SetTarget(mWindow.GetRenderer());
+            mCamera.Configure(mEcosystem.GetWorldWidth(), mEcosystem.GetWorldHeight(),
+                              mWindow.GetWidth(), mWindow.GetHeight());
 
-            // Configuration initiale : 20 herbivores, 5 carnivores, 30 plantes
-            mEcosystem.Initialize(20, 5, 30);
+            // Population de départ de la configuration (20 herbivores, 5 carnivores, 30 plantes par défaut)
+            mEcosystem.Initialize();
 
             mIsRunning = true;
+            mAccumulatedTime = 0.0f;
             mLastUpdateTime = std::chrono::high_resolution_clock::now();
 
-            std::cout << "✅ Moteur de jeu initialisé" << std::endl;
+            ECO_LOG_INFO("✅ Moteur de jeu initialisé");
+            return true;
+        }
+
+        // 💾 REPRISE D'UNE SAUVEGARDE (après Initialize)
+        bool GameEngine::LoadSnapshot(const std::string &path)
+        {
+            if (!Snapshot::Load(mEcosystem, path))
+                return false;
+            mAccumulatedTime = 0.0f;
             return true;
         }
 
         // 🔄 BOUCLE PRINCIPALE
         void GameEngine::Run()
         {
-            std::cout << "🎯 Démarrage de la boucle de jeu..." << std::endl;
+            ECO_LOG_INFO("🎯 Démarrage de la boucle de jeu...");
+
+            const float frameBudget = 1.0f / 60.0f;
 
             while (mIsRunning)
             {
@@ -48,32 +85,72 @@ namespace Ecosystem
                 std::chrono::duration<float> elapsed = currentTime - mLastUpdateTime;
                 mLastUpdateTime = currentTime;
 
-                float deltaTime = elapsed.count();
+                // Une image très lente (fenêtre déplacée, débogueur...) ne doit pas
+                // provoquer un rattrapage énorme
+                float deltaTime = std::min(elapsed.count(), 0.25f);
 
                 // Gestion des événements (clavier/souris)
                 HandleEvents();
 
-                // Mise à jour de la logique (si pas en pause)
+                // Mise à jour de la logique par pas fixes (si pas en pause)
+                float fixedStep = 1.0f / mSimulationRate;
+                int steps = 0;
                 if (!mIsPaused)
                 {
                     // On multiplie par mTimeScale pour accélérer/ralentir le temps
-                    Update(deltaTime * mTimeScale);
+                    mAccumulatedTime += deltaTime * mTimeScale;
+
+                    while (mAccumulatedTime >= fixedStep && steps < mMaxStepsPerFrame)
+                    {
+                        Update(fixedStep);
+                        mAccumulatedTime -= fixedStep;
+                        steps++;
+                    }
+
+                    // Limite atteinte : on abandonne le retard plutôt que de l'accumuler
+                    if (steps == mMaxStepsPerFrame && mAccumulatedTime >= fixedStep)
+                    {
+                        mAccumulatedTime = std::min(mAccumulatedTime, fixedStep);
+                    }
                 }
 
-                // Dessin
-                Render();
+                // Dessin, interpolé entre les deux derniers états de la simulation
+                Render(std::min(mAccumulatedTime / fixedStep, 1.0f));
 
-                // Limitation à ~60 FPS pour ne pas surchauffer le CPU
-                SDL_Delay(16);
+                // Limitation à ~60 FPS pour ne pas surchauffer le CPU : on ne dort
+                // que le temps restant de l'image
+                std::chrono::duration<float> frameTime = std::chrono::high_resolution_clock::now() - currentTime;
+                mEcosystem.GetProfiler().RecordFrame(frameTime.count() * 1000.0f, mLastRenderMs,
+                                                     static_cast<uint32_t>(steps));
+                if (frameTime.count() < frameBudget)
+                {
+                    SDL_Delay(static_cast<Uint32>((frameBudget - frameTime.count()) * 1000.0f));
+                }
             }
         }
 
+        // ⏱ RÉGLAGES DE LA BOUCLE
+        void GameEngine::SetSimulationRate(float stepsPerSecond)
+        {
+            if (stepsPerSecond > 0.0f)
+                mSimulationRate = stepsPerSecond;
+        }
+
+        void GameEngine::SetMaxStepsPerFrame(int maxSteps)
+        {
+            if (maxSteps > 0)
+                mMaxStepsPerFrame = maxSteps;
+        }
+
         // 🛑 FERMETURE
         void GameEngine::Shutdown()
         {
             mIsRunning = false;
+            mReplay.Close();
+            mStatsWriter.Close();
+            mStaticLayer.Release(); // La texture appartient au renderer de la fenêtre
             mWindow.Shutdown(); // Fermeture explicite de la fenêtre
-            std::cout << "🔄 Moteur de jeu arrêté" << std::endl;
+            ECO_LOG_INFO("🔄 Moteur de jeu arrêté");
         }
 
         // 🎮 GESTION DES ÉVÉNEMENTS
@@ -90,6 +167,21 @@ namespace Ecosystem
                 case SDL_EVENT_KEY_DOWN:
                     HandleInput(event.key.key);
                     break;
+                case SDL_EVENT_MOUSE_WHEEL:
+                    // Zoom centré sur le curseur (un cran = kZoomStep)
+                    mCamera.ZoomAt(std::pow(Graphics::Camera::kZoomStep, event.wheel.y),
+                                   event.wheel.mouse_x, event.wheel.mouse_y);
+                    break;
+                case SDL_EVENT_MOUSE_MOTION:
+                    // Glisser avec un bouton enfoncé : le monde suit la souris
+                    if (event.motion.state != 0)
+                        mCamera.Pan(event.motion.xrel, event.motion.yrel);
+                    break;
+                case SDL_EVENT_RENDER_TARGETS_RESET:
+                case SDL_EVENT_RENDER_DEVICE_RESET:
+                    // Contenu des textures perdu : la couche statique sera recréée et redessinée
+                    mStaticLayer.Release();
+                    break;
                 }
             }
         }
@@ -104,25 +196,61 @@ namespace Ecosystem
                 break;
             case SDLK_SPACE:
                 mIsPaused = !mIsPaused;
-                std::cout << (mIsPaused ? "⏸ Simulation en pause" : "▶ Simulation reprise") << std::endl;
+                ECO_LOG_INFO("%s", mIsPaused ? "⏸ Simulation en pause" : "▶ Simulation reprise");
                 break;
             case SDLK_R:
-                mEcosystem.Initialize(20, 5, 30);
-                std::cout << "🔄 Simulation réinitialisée" << std::endl;
+                mReplay.RecordCommand(mEcosystem, ReplayLog::Command::Reset);
+                ReplayLog::Apply(mEcosystem, ReplayLog::Command::Reset, 0);
+                ECO_LOG_INFO("🔄 Simulation réinitialisée");
                 break;
             case SDLK_F:
-                mEcosystem.SpawnFood(10);
-                std::cout << "🍎 Nourriture ajoutée" << std::endl;
+                mReplay.RecordCommand(mEcosystem, ReplayLog::Command::SpawnFood, mEcosystem.GetConfig().foodPerSpawn);
+                ReplayLog::Apply(mEcosystem, ReplayLog::Command::SpawnFood, mEcosystem.GetConfig().foodPerSpawn);
+                ECO_LOG_INFO("🍎 Nourriture ajoutée");
                 break;
             case SDLK_UP:
                 mTimeScale *= 1.5f;
-                std::cout << "⏩ Vitesse: " << mTimeScale << "x" << std::endl;
+                ECO_LOG_INFO("⏩ Vitesse: %gx", mTimeScale);
                 break;
             case SDLK_DOWN:
                 mTimeScale /= 1.5f;
                 if (mTimeScale < 0.1f)
                     mTimeScale = 0.1f;
-                std::cout << "⏪ Vitesse: " << mTimeScale << "x" << std::endl;
+                ECO_LOG_INFO("⏪ Vitesse: %gx", mTimeScale);
+                break;
+            case SDLK_P:
+                mShowProfiler = !mShowProfiler;
+                break;
+            // 🎥 Caméra (les flèches haut/bas règlent déjà la vitesse)
+            case SDLK_EQUALS:
+            case SDLK_KP_PLUS:
+                mCamera.Zoom(Graphics::Camera::kZoomStep);
+                break;
+            case SDLK_MINUS:
+            case SDLK_KP_MINUS:
+                mCamera.Zoom(1.0f / Graphics::Camera::kZoomStep);
+                break;
+            case SDLK_W:
+                mCamera.Pan(0.0f, kPanStep * mCamera.GetViewportHeight());
+                break;
+            case SDLK_S:
+                mCamera.Pan(0.0f, -kPanStep * mCamera.GetViewportHeight());
+                break;
+            case SDLK_A:
+                mCamera.Pan(kPanStep * mCamera.GetViewportWidth(), 0.0f);
+                break;
+            case SDLK_D:
+                mCamera.Pan(-kPanStep * mCamera.GetViewportWidth(), 0.0f);
+                break;
+            case SDLK_0:
+                mCamera.Fit();
+                break;
+            case SDLK_F5:
+                Snapshot::Save(mEcosystem, mSnapshotPath);
+                break;
+            case SDLK_F9:
+                mReplay.RecordCommand(mEcosystem, ReplayLog::Command::LoadSnapshot);
+                LoadSnapshot(mSnapshotPath);
                 break;
             }
         }
@@ -131,34 +259,38 @@ namespace Ecosystem
         void GameEngine::Update(float deltaTime)
         {
             mEcosystem.Update(deltaTime);
+            mReplay.RecordTick(mEcosystem);
 
-            // Affichage occasionnel des statistiques (toutes les 2 secondes)
-            static float statsTimer = 0.0f;
-            statsTimer += deltaTime;
+            mStatsWriter.Append(mEcosystem.GetSeries().Get(0));
 
-            if (statsTimer >= 2.0f)
+            // Affichage occasionnel des statistiques (toutes les 2 secondes simulées)
+            int statsInterval = std::max(1, static_cast<int>(2.0f * mSimulationRate + 0.5f));
+            if (mEcosystem.GetDayCycle() % statsInterval == 0)
             {
                 auto stats = mEcosystem.GetStatistics();
-                std::cout << "📊 Stats - Herbivores: " << stats.totalHerbivores
-                          << ", Carnivores: " << stats.totalCarnivores
-                          << ", Plantes: " << stats.totalPlants
-                          << ", Naissances: " << stats.birthsToday
-                          << ", Morts: " << stats.deathsToday << std::endl;
-                statsTimer = 0.0f;
+                ECO_LOG_INFO("📊 Stats - Herbivores: %d, Carnivores: %d, Plantes: %d, Naissances: %d, Morts: %d",
+                             stats.totalHerbivores, stats.totalCarnivores, stats.totalPlants,
+                             stats.birthsToday, stats.deathsToday);
             }
         }
 
         // 🎨 RENDU
-        void GameEngine::Render()
+        void GameEngine::Render(float alpha)
         {
+            auto renderStart = Profiler::Now();
+
             // 1. Effacer l'écran
             mWindow.Clear();
 
-            // 2. Dessiner l'écosystème
-            mEcosystem.Render(mWindow.GetRenderer());
+            // 2. Dessiner la partie visible de l'écosystème (un seul lot de géométrie pour toute
+            //    l'image) ; la vue de la caméra ne s'applique qu'ici, l'interface reste à l'échelle 1
+            mRenderer.Begin();
+            mEcosystem.Render(mRenderer, mStaticLayer, mCamera, alpha);
+            mRenderer.Flush();
 
             // 3. Dessiner l'interface (UI)
             RenderUI();
+            mLastRenderMs = Profiler::ElapsedMs(renderStart);
 
             // 4. Afficher le résultat
             mWindow.Present();
@@ -167,7 +299,85 @@ namespace Ecosystem
         // 🖥 INTERFACE UTILISATEUR
         void GameEngine::RenderUI()
         {
-            // Pour l'instant vide (Bonus : afficher du texte avec SDL_ttf ici)
+            if (mShowProfiler)
+            {
+                RenderProfilerGraph();
+            }
+        }
+
+        // 📒 GRAPHIQUE DES TEMPS
+        // En bas à gauche, un bâton par tick (phases empilées, couleurs de la légende) ;
+        // juste au-dessus, un bâton par image (rendu en blanc, le reste en gris) avec la
+        // ligne jaune du budget de 16,7 ms.
+        void GameEngine::RenderProfilerGraph()
+        {
+            const Profiler &profiler = mEcosystem.GetProfiler();
+            float left = kGraphMargin;
+            float tickBase = mWindow.GetHeight() - kGraphMargin;
+            float frameBase = tickBase - kGraphHeight - kGraphMargin;
+            float width = kGraphBars * kGraphBarWidth;
+
+            mRenderer.Begin();
+            mRenderer.FillRect(left, frameBase - kGraphHeight, width, kGraphHeight, Color(0, 0, 0, 160));
+            mRenderer.FillRect(left, tickBase - kGraphHeight, width, kGraphHeight, Color(0, 0, 0, 160));
+
+            // Ticks : phases empilées, le plus récent à droite
+            std::size_t ticks = std::min(profiler.GetTickCount(), kGraphBars);
+            for (std::size_t age = 0; age < ticks; ++age)
+            {
+                const Profiler::TickRecord &record = profiler.GetTick(age);
+                float x = left + width - (age + 1) * kGraphBarWidth;
+                float y = tickBase;
+                for (std::size_t phase = 0; phase < Profiler::kPhaseCount; ++phase)
+                {
+                    float height = std::min(record.phaseMs[phase] * kGraphMsScale, y - (tickBase - kGraphHeight));
+                    if (height <= 0.0f)
+                        continue;
+                    y -= height;
+                    mRenderer.FillRect(x, y, kGraphBarWidth, height, Profiler::GetPhaseColor(static_cast<ProfilePhase>(phase)));
+                }
+            }
+
+            // Images : rendu + reste de l'image
+            std::size_t frames = std::min(profiler.GetFrameCount(), kGraphBars);
+            for (std::size_t age = 0; age < frames; ++age)
+            {
+                const Profiler::FrameRecord &frame = profiler.GetFrame(age);
+                float x = left + width - (age + 1) * kGraphBarWidth;
+                float total = std::min(frame.frameMs * kGraphMsScale, kGraphHeight);
+                float render = std::min(frame.renderMs * kGraphMsScale, total);
+                mRenderer.FillRect(x, frameBase - total, kGraphBarWidth, total - render, Color(110, 110, 110));
+                mRenderer.FillRect(x, frameBase - render, kGraphBarWidth, render, Color(230, 230, 230));
+            }
+            mRenderer.FillRect(left, frameBase - kFrameBudgetMs * kGraphMsScale, width, 1.0f, Color::Yellow());
+
+            // Légende : un carré de couleur par phase
+            float legendX = left + width + kGraphMargin;
+            for (std::size_t phase = 0; phase < Profiler::kPhaseCount; ++phase)
+            {
+                float y = tickBase - kGraphHeight + phase * 11.0f;
+                mRenderer.FillRect(legendX, y, 8.0f, 8.0f, Profiler::GetPhaseColor(static_cast<ProfilePhase>(phase)));
+            }
+            mRenderer.Flush();
+
+            // Textes (police de débogage intégrée à SDL)
+            SDL_Renderer *sdlRenderer = mRenderer.GetSDLRenderer();
+            SDL_SetRenderDrawColor(sdlRenderer, 255, 255, 255, 255);
+            for (std::size_t phase = 0; phase < Profiler::kPhaseCount; ++phase)
+            {
+                float y = tickBase - kGraphHeight + phase * 11.0f;
+                SDL_RenderDebugText(sdlRenderer, legendX + 12.0f, y, Profiler::GetPhaseName(static_cast<ProfilePhase>(phase)));
+            }
+            if (profiler.GetTickCount() > 0 && profiler.GetFrameCount() > 0)
+            {
+                const Profiler::TickRecord &tick = profiler.GetTick(0);
+                const Profiler::FrameRecord &frame = profiler.GetFrame(0);
+                char text[128];
+                std::snprintf(text, sizeof(text), "tick %.2f ms  image %.2f ms  rendu %.2f ms  %u entites  %llu allocs",
+                              tick.totalMs, frame.frameMs, frame.renderMs, tick.entities,
+                              static_cast<unsigned long long>(tick.allocations));
+                SDL_RenderDebugText(sdlRenderer, left, frameBase - kGraphHeight - 12.0f, text);
+            }
         }
 
     } // namespace Core
@@ -0,0 +1,147 @@
+#include "Core/HeadlessRunner.h"
+#include "Core/Logger.h"
+#include "Core/ReplayLog.h"
+#include "Core/Snapshot.h"
+#include "Core/StatisticsWriter.h"
+#include <chrono>
+#include <cstdio> // Pour std::fopen
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🏗 CONSTRUCTEUR
+        HeadlessRunner::HeadlessRunner(const WorldConfig &config)
+            : mEcosystem(config)
+        {
+        }
+
+        HeadlessRunner::HeadlessRunner(float width, float height, int maxEntities)
+            : mEcosystem(width, height, maxEntities)
+        {
+        }
+
+        // ⚙ INITIALISATION
+        void HeadlessRunner::Initialize(int initialHerbivores, int initialCarnivores, int initialPlants)
+        {
+            mEcosystem.Initialize(initialHerbivores, initialCarnivores, initialPlants);
+        }
+
+        void HeadlessRunner::Initialize()
+        {
+            mEcosystem.Initialize();
+        }
+
+        bool HeadlessRunner::LoadSnapshot(const std::string &path)
+        {
+            return Snapshot::Load(mEcosystem, path);
+        }
+
+        namespace
+        {
+            // Le profileur garde 512 ticks : on vide l'anneau bien avant qu'il ne déborde
+            constexpr int64_t kCsvFlushInterval = 256;
+        }
+
+        // 🔄 BOUCLE À PAS FIXE
+        HeadlessRunner::Report HeadlessRunner::Run(const Options &options)
+        {
+            Report report;
+
+            // Export CSV du profileur
+            std::FILE *csv = nullptr;
+            uint64_t nextCsvTick = 0;
+            if (!options.profileCsvPath.empty())
+            {
+                csv = std::fopen(options.profileCsvPath.c_str(), "w");
+                if (!csv)
+                {
+                    ECO_LOG_ERROR("❌ Impossible d'ouvrir %s", options.profileCsvPath.c_str());
+                    report.failed = true;
+                    return report;
+                }
+                Profiler::WriteCsvHeader(csv);
+            }
+            const Profiler &profiler = mEcosystem.GetProfiler();
+
+            // Journal de rejeu et série des statistiques (écrite par un thread d'arrière-plan) ;
+            // Open signale lui-même l'erreur
+            ReplayLog replay;
+            StatisticsWriter statsWriter;
+            if ((!options.recordPath.empty() && !replay.Open(options.recordPath, mEcosystem, options.timeStep)) ||
+                (!options.statsPath.empty() && !statsWriter.Open(options.statsPath)))
+            {
+                if (csv)
+                    std::fclose(csv);
+                report.failed = true;
+                return report;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+
+            while (options.maxTicks == 0 || report.ticks < options.maxTicks)
+            {
+                report.entityUpdates += mEcosystem.GetEntityCount();
+                mEcosystem.Update(options.timeStep);
+                replay.RecordTick(mEcosystem);
+                statsWriter.Append(mEcosystem.GetSeries().Get(0));
+                report.ticks++;
+
+                if (csv && report.ticks % kCsvFlushInterval == 0)
+                    profiler.WriteCsv(csv, nextCsvTick);
+
+                if (!options.snapshotPath.empty() && options.snapshotInterval > 0 &&
+                    report.ticks % options.snapshotInterval == 0)
+                    Snapshot::Save(mEcosystem, options.snapshotPath);
+
+                if (options.stopOnExtinction)
+                {
+                    auto stats = mEcosystem.GetStatistics();
+                    if (stats.totalHerbivores + stats.totalCarnivores == 0)
+                    {
+                        report.extinct = true;
+                        break;
+                    }
+                }
+            }
+
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            report.seconds = elapsed.count();
+
+            if (!options.snapshotPath.empty())
+                Snapshot::Save(mEcosystem, options.snapshotPath);
+
+            if (csv)
+            {
+                profiler.WriteCsv(csv, nextCsvTick);
+                std::fclose(csv);
+                ECO_LOG_INFO("📄 Profil écrit dans %s", options.profileCsvPath.c_str());
+            }
+            return report;
+        }
+
+        // 📊 AFFICHAGE DU DÉBIT
+        void HeadlessRunner::PrintReport(const Report &report)
+        {
+            double seconds = report.seconds > 0.0 ? report.seconds : 1e-9;
+            ECO_LOG_INFO("⚡ Simulation sans fenêtre terminée: %lld ticks en %g s%s",
+                         static_cast<long long>(report.ticks), report.seconds, report.extinct ? " (extinction)" : "");
+            ECO_LOG_INFO("   Ticks/s: %lld, Mises à jour d'entités/s: %lld",
+                         static_cast<long long>(report.ticks / seconds),
+                         static_cast<long long>(report.entityUpdates / seconds));
+
+            // Événements du cycle de vie : comptés pendant la simulation, affichés une seule fois
+            Logger &logger = Logger::Instance();
+            ECO_LOG_INFO("   Créations: %llu, Naissances: %llu, Repas: %llu, Morts (faim/âge/prédation/broutées): %llu/%llu/%llu/%llu",
+                         static_cast<unsigned long long>(logger.GetEventCount(LifecycleEvent::Created)),
+                         static_cast<unsigned long long>(logger.GetEventCount(LifecycleEvent::Born)),
+                         static_cast<unsigned long long>(logger.GetEventCount(LifecycleEvent::Meal)),
+                         static_cast<unsigned long long>(logger.GetEventCount(LifecycleEvent::DiedOfHunger)),
+                         static_cast<unsigned long long>(logger.GetEventCount(LifecycleEvent::DiedOfAge)),
+                         static_cast<unsigned long long>(logger.GetEventCount(LifecycleEvent::Preyed)),
+                         static_cast<unsigned long long>(logger.GetEventCount(LifecycleEvent::Grazed)));
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,175 @@
+#include "Core/JobSystem.h"
+#include <algorithm> // Pour std::min
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🏗 CONSTRUCTEUR : démarrage du pool
+        JobSystem::JobSystem(unsigned workerCount)
+            : mQueuedTasks(0), mRemainingTasks(0), mStopping(false)
+        {
+            if (workerCount == 0)
+            {
+                workerCount = std::thread::hardware_concurrency();
+                if (workerCount == 0)
+                    workerCount = 1; // Valeur inconnue : on reste mono-thread
+            }
+
+            // Le thread appelant compte comme un travailleur
+            unsigned poolSize = workerCount - 1;
+            for (unsigned i = 0; i <= poolSize; ++i)
+            {
+                mQueues.push_back(std::make_unique<WorkQueue>());
+            }
+            for (unsigned i = 1; i <= poolSize; ++i)
+            {
+                mThreads.emplace_back(&JobSystem::WorkerLoop, this, i);
+            }
+        }
+
+        // 🗑 DESTRUCTEUR : arrêt propre des threads
+        JobSystem::~JobSystem()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mWakeMutex);
+                mStopping = true;
+            }
+            mWakeCondition.notify_all();
+            for (auto &thread : mThreads)
+            {
+                thread.join();
+            }
+        }
+
+        std::size_t JobSystem::ChunkCount(std::size_t count, std::size_t chunkSize)
+        {
+            if (chunkSize == 0)
+                chunkSize = 1;
+            return (count + chunkSize - 1) / chunkSize;
+        }
+
+        // 🔀 EXÉCUTION PARALLÈLE PAR BLOCS
+        void JobSystem::ParallelFor(std::size_t count, std::size_t chunkSize, const ChunkJob &job)
+        {
+            if (chunkSize == 0)
+                chunkSize = 1;
+            std::size_t chunks = ChunkCount(count, chunkSize);
+            if (chunks == 0)
+                return;
+
+            // Un seul bloc ou pas de pool : pas la peine de réveiller qui que ce soit
+            if (chunks == 1 || mThreads.empty())
+            {
+                for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+                {
+                    std::size_t begin = chunk * chunkSize;
+                    job(chunk, begin, std::min(begin + chunkSize, count));
+                }
+                return;
+            }
+
+            mRemainingTasks.store(chunks);
+
+            // Compteur augmenté AVANT la publication : un vol ne peut pas le faire passer
+            // sous zéro (il déborderait et les threads tourneraient au lieu de dormir)
+            mQueuedTasks.fetch_add(chunks);
+
+            // Distribution des blocs en tourniquet dans les files
+            for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                std::size_t begin = chunk * chunkSize;
+                Task task{&job, chunk, begin, std::min(begin + chunkSize, count)};
+                WorkQueue &queue = *mQueues[chunk % mQueues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.tasks.push_back(task);
+            }
+            {
+                // Verrou pris puis relâché : un thread entre son test et son sommeil ne peut
+                // pas manquer la notification
+                std::lock_guard<std::mutex> lock(mWakeMutex);
+            }
+            mWakeCondition.notify_all();
+
+            // Le thread appelant travaille aussi jusqu'à ce que tout soit terminé
+            Task task;
+            while (mRemainingTasks.load() > 0)
+            {
+                if (TryPop(0, task) || TrySteal(0, task))
+                {
+                    Execute(task);
+                    continue;
+                }
+
+                // Plus rien à prendre : on attend les blocs encore en cours ailleurs
+                std::unique_lock<std::mutex> lock(mWakeMutex);
+                mDoneCondition.wait(lock, [this]
+                                    { return mRemainingTasks.load() == 0 || mQueuedTasks.load() > 0; });
+            }
+        }
+
+        // 👷 BOUCLE D'UN THREAD DU POOL
+        void JobSystem::WorkerLoop(std::size_t queueIndex)
+        {
+            Task task;
+            while (true)
+            {
+                if (TryPop(queueIndex, task) || TrySteal(queueIndex, task))
+                {
+                    Execute(task);
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(mWakeMutex);
+                mWakeCondition.wait(lock, [this]
+                                    { return mStopping || mQueuedTasks.load() > 0; });
+                if (mStopping)
+                    return;
+            }
+        }
+
+        // Sa propre file : on prend par l'arrière (blocs les plus récents, encore en cache)
+        bool JobSystem::TryPop(std::size_t queueIndex, Task &task)
+        {
+            WorkQueue &queue = *mQueues[queueIndex];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (queue.tasks.empty())
+                return false;
+            task = queue.tasks.back();
+            queue.tasks.pop_back();
+            mQueuedTasks.fetch_sub(1);
+            return true;
+        }
+
+        // File d'un autre : on vole par l'avant
+        bool JobSystem::TrySteal(std::size_t queueIndex, Task &task)
+        {
+            for (std::size_t offset = 1; offset < mQueues.size(); ++offset)
+            {
+                WorkQueue &queue = *mQueues[(queueIndex + offset) % mQueues.size()];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                    continue;
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+                mQueuedTasks.fetch_sub(1);
+                return true;
+            }
+            return false;
+        }
+
+        void JobSystem::Execute(const Task &task)
+        {
+            (*task.job)(task.chunk, task.begin, task.end);
+
+            if (mRemainingTasks.fetch_sub(1) == 1)
+            {
+                // Dernier bloc terminé : on réveille l'appelant
+                std::lock_guard<std::mutex> lock(mWakeMutex);
+                mDoneCondition.notify_all();
+            }
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,69 @@
+#include "Core/LodScheduler.h"
+#include <algorithm> // Pour std::min, std::max
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🗺 CARTE DES RÉGIONS ACTIVES
+        void LodScheduler::MarkActivity(const EntityStore &store, const SpatialGrid &grid)
+        {
+            if (mInterval <= 1)
+                return;
+
+            int columns = grid.GetColumns();
+            int rows = grid.GetRows();
+            mActive.assign(grid.GetCellCount(), 0);
+
+            for (std::size_t i = 0; i < store.Size(); ++i)
+            {
+                if (!store.alive[i] || !store.species[store.type[i]].IsMobile())
+                    continue;
+
+                // La cellule de l'entité et ses 8 voisines
+                std::size_t cell = grid.GetCellIndex(store.positionX[i], store.positionY[i]);
+                int column = static_cast<int>(cell % columns);
+                int row = static_cast<int>(cell / columns);
+                for (int y = std::max(row - 1, 0); y <= std::min(row + 1, rows - 1); ++y)
+                {
+                    for (int x = std::max(column - 1, 0); x <= std::min(column + 1, columns - 1); ++x)
+                        mActive[static_cast<std::size_t>(y) * columns + x] = 1;
+                }
+            }
+        }
+
+        // 📅 QUI EST MIS À JOUR CE TICK ?
+        void LodScheduler::Schedule(EntityStore &store, const SpatialGrid &grid, std::size_t begin, std::size_t end) const
+        {
+            bool detailed = mInterval <= 1 || mActive.size() != grid.GetCellCount();
+            uint64_t phaseMask = static_cast<uint64_t>(mInterval) - 1; // interval est une puissance de 2
+            bool mobile[kMaxSpecies] = {};
+            for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                mobile[t] = store.species.traits[t].IsMobile();
+
+            if (detailed)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    store.updateSteps[i] = static_cast<uint8_t>(store.lodDebt[i] + 1);
+                    store.lodDebt[i] = 0;
+                }
+                return;
+            }
+
+            // Sans branche par entité : au repos ou non, le motif est imprévisible
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                uint8_t due = mobile[static_cast<uint8_t>(store.type[i])] |
+                              static_cast<uint8_t>(((store.id[i] + store.tick) & phaseMask) == 0) |
+                              mActive[grid.GetCellIndex(store.positionX[i], store.positionY[i])];
+                // Le tick courant et ceux passés au repos, ou un tick de retard de plus
+                uint8_t pending = static_cast<uint8_t>(store.lodDebt[i] + 1);
+                store.updateSteps[i] = static_cast<uint8_t>(pending * due);
+                store.lodDebt[i] = static_cast<uint8_t>(pending * (1 - due));
+            }
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
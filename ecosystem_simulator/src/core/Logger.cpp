@@ -0,0 +1,160 @@
+#include "Core/Logger.h"
+#include <chrono>
+#include <cstdarg> // Pour va_list
+#include <cstdio>  // Pour std::vsnprintf, std::fputs
+#include <cstring> // Pour std::strcmp
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🏗 INSTANCE UNIQUE (créée au premier message)
+        Logger &Logger::Instance()
+        {
+            static Logger instance;
+            return instance;
+        }
+
+        Logger::Logger()
+            : mSlots(new Slot[kCapacity]),
+              mEnqueuePosition(0), mDequeuePosition(0), mWrittenCount(0),
+              mLevel(static_cast<int>(LogLevel::Info)), mDropped(0), mStopping(false)
+        {
+            // Chaque case connaît le "numéro de passage" qu'elle attend
+            for (std::size_t i = 0; i < kCapacity; ++i)
+            {
+                mSlots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+            for (auto &count : mEventCounts)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+            mWriterThread = std::thread(&Logger::WriterLoop, this);
+        }
+
+        // 🗑 DESTRUCTEUR : on affiche ce qui reste avant de quitter
+        Logger::~Logger()
+        {
+            mStopping.store(true);
+            mWriterThread.join();
+        }
+
+        // ✍ ÉCRITURE D'UN MESSAGE (producteurs multiples, sans verrou)
+        void Logger::Write(LogLevel level, const char *format, ...)
+        {
+            std::size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+            Slot *slot = nullptr;
+
+            // Réservation d'une case : la case est libre si sa séquence vaut notre position
+            while (true)
+            {
+                slot = &mSlots[position & (kCapacity - 1)];
+                std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+                if (difference == 0)
+                {
+                    if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (difference < 0)
+                {
+                    // Tampon plein : on ne bloque jamais la simulation
+                    mDropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                else
+                {
+                    position = mEnqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            // Formatage directement dans la case réservée
+            slot->level = level;
+            va_list arguments;
+            va_start(arguments, format);
+            std::vsnprintf(slot->text, kMessageSize, format, arguments);
+            va_end(arguments);
+
+            // Publication : le thread d'écriture peut maintenant lire la case
+            slot->sequence.store(position + 1, std::memory_order_release);
+        }
+
+        // ⏳ ATTENTE DE L'AFFICHAGE
+        void Logger::Flush()
+        {
+            std::size_t target = mEnqueuePosition.load(std::memory_order_acquire);
+            while (mWrittenCount.load(std::memory_order_acquire) < target && !mStopping.load())
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        }
+
+        // 🧵 THREAD D'ÉCRITURE
+        void Logger::WriterLoop()
+        {
+            while (true)
+            {
+                std::size_t written = Drain();
+                if (written == 0)
+                {
+                    if (mStopping.load())
+                        break;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+            Drain(); // Derniers messages publiés pendant l'arrêt
+        }
+
+        // Vide toutes les cases publiées ; un seul fflush par paquet
+        std::size_t Logger::Drain()
+        {
+            std::size_t written = 0;
+            bool wroteErrors = false;
+
+            while (true)
+            {
+                Slot &slot = mSlots[mDequeuePosition & (kCapacity - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != mDequeuePosition + 1)
+                    break;
+
+                bool isError = slot.level >= LogLevel::Warning;
+                std::FILE *output = isError ? stderr : stdout;
+                std::fputs(slot.text, output);
+                std::fputc('\n', output);
+                wroteErrors = wroteErrors || isError;
+
+                // La case redevient libre pour le passage suivant dans l'anneau
+                slot.sequence.store(mDequeuePosition + kCapacity, std::memory_order_release);
+                ++mDequeuePosition;
+                ++written;
+            }
+
+            if (written > 0)
+            {
+                std::fflush(stdout);
+                if (wroteErrors)
+                    std::fflush(stderr);
+                mWrittenCount.fetch_add(written, std::memory_order_release);
+            }
+            return written;
+        }
+
+        // 🔤 NOM → NIVEAU
+        bool Logger::ParseLevel(const char *name, LogLevel &level)
+        {
+            static const char *const names[] = {"trace", "debug", "info", "warning", "error", "off"};
+            for (int i = 0; i <= static_cast<int>(LogLevel::Off); ++i)
+            {
+                if (std::strcmp(name, names[i]) == 0)
+                {
+                    level = static_cast<LogLevel>(i);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,84 @@
+#include "Core/PopulationCensus.h"
+#include <cstring> // Pour std::memset
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🧹 RECENSEMENT VIDE
+        void PopulationCensus::Reset(uint64_t tick)
+        {
+            std::memset(mPopulation, 0, sizeof(mPopulation));
+            std::memset(mEnergy, 0, sizeof(mEnergy));
+            std::memset(mRecent, 0, sizeof(mRecent));
+            std::memset(mOlder, 0, sizeof(mOlder));
+            mCurrentBucket = tick / kAgeBucketTicks;
+        }
+
+        // ⏩ LE PRÉSENT AVANCE
+        void PopulationCensus::Advance(uint64_t tick)
+        {
+            uint64_t bucket = tick / kAgeBucketTicks;
+            // Au plus kRecentBuckets classes à replier, même après un long saut
+            for (std::size_t step = 0; mCurrentBucket < bucket && step < kRecentBuckets; ++step)
+            {
+                mCurrentBucket++;
+                // Les nés de la classe mCurrentBucket - kRecentBuckets rejoignent les plus âgés ;
+                // leur case de l'anneau accueille la nouvelle classe
+                std::size_t slot = static_cast<std::size_t>(mCurrentBucket % kRecentBuckets);
+                for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                {
+                    mOlder[t] += mRecent[t][slot];
+                    mRecent[t][slot] = 0;
+                }
+            }
+            if (mCurrentBucket < bucket)
+                mCurrentBucket = bucket; // Anneau déjà vide
+        }
+
+        uint32_t &PopulationCensus::BucketFor(std::size_t type, uint64_t birthBucket)
+        {
+            if (birthBucket + kRecentBuckets <= mCurrentBucket)
+                return mOlder[type];
+            return mRecent[type][birthBucket % kRecentBuckets];
+        }
+
+        // 🌱 / 💀 ÉVÉNEMENTS
+        void PopulationCensus::OnAdded(EntityType type, float energy, uint64_t birthTick)
+        {
+            std::size_t t = static_cast<std::size_t>(type);
+            mPopulation[t]++;
+            mEnergy[t] += EnergyLedger::Quantize(energy);
+            BucketFor(t, birthTick / kAgeBucketTicks)++;
+        }
+
+        void PopulationCensus::OnRemoved(EntityType type, float energy, uint64_t birthTick)
+        {
+            std::size_t t = static_cast<std::size_t>(type);
+            mPopulation[t]--;
+            mEnergy[t] -= EnergyLedger::Quantize(energy);
+            BucketFor(t, birthTick / kAgeBucketTicks)--;
+        }
+
+        // 🔍 LECTURE
+        uint32_t PopulationCensus::GetTotalPopulation() const
+        {
+            uint32_t total = 0;
+            for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                total += mPopulation[t];
+            return total;
+        }
+
+        uint32_t PopulationCensus::GetAgeBucket(EntityType type, std::size_t bucket) const
+        {
+            std::size_t t = static_cast<std::size_t>(type);
+            if (bucket >= kRecentBuckets)
+                return mOlder[t];
+            if (bucket > mCurrentBucket)
+                return 0; // Avant le début de la simulation
+            return mRecent[t][(mCurrentBucket - bucket) % kRecentBuckets];
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,115 @@
+#include "Core/Profiler.h"
+#include "Core/AllocationCounter.h"
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🏗 CONSTRUCTEUR (les anneaux sont alloués une fois pour toutes)
+        Profiler::Profiler()
+            : mTicks(kCapacity), mFrames(kCapacity), mTickCount(0), mFrameCount(0),
+              mAllocationsAtStart(0), mEnabled(true)
+        {
+        }
+
+        // ▶ DÉBUT D'UN TICK
+        void Profiler::BeginTick(uint64_t tick)
+        {
+            if (!mEnabled)
+                return;
+            mCurrent = TickRecord();
+            mCurrent.tick = tick;
+            mAllocationsAtStart = GetAllocationCount();
+            mTickStart = Clock::now();
+        }
+
+        // ⏹ FIN D'UN TICK : la ligne rejoint l'anneau
+        void Profiler::EndTick(std::size_t entities, std::size_t food)
+        {
+            if (!mEnabled)
+                return;
+            mCurrent.totalMs = ElapsedMs(mTickStart);
+            mCurrent.entities = static_cast<uint32_t>(entities);
+            mCurrent.food = static_cast<uint32_t>(food);
+            mCurrent.allocations = GetAllocationCount() - mAllocationsAtStart;
+
+            mTicks[mTickCount % kCapacity] = mCurrent;
+            mTickCount++;
+        }
+
+        // 🖼 IMAGE
+        void Profiler::RecordFrame(float frameMs, float renderMs, uint32_t ticks)
+        {
+            if (!mEnabled)
+                return;
+            FrameRecord &frame = mFrames[mFrameCount % kCapacity];
+            frame.frameMs = frameMs;
+            frame.renderMs = renderMs;
+            frame.ticks = ticks;
+            mFrameCount++;
+        }
+
+        // 📄 EXPORT CSV
+        void Profiler::WriteCsvHeader(std::FILE *file)
+        {
+            std::fprintf(file, "tick,entities,food,allocations,total_ms");
+            for (std::size_t phase = 0; phase < kPhaseCount; ++phase)
+            {
+                std::fprintf(file, ",%s_ms", GetPhaseName(static_cast<ProfilePhase>(phase)));
+            }
+            std::fputc('\n', file);
+        }
+
+        std::size_t Profiler::WriteCsv(std::FILE *file, uint64_t &nextTick) const
+        {
+            // Les ticks trop anciens ont été écrasés dans l'anneau : on repart du plus vieux restant
+            uint64_t oldest = mTickCount - GetTickCount();
+            std::size_t written = 0;
+
+            for (uint64_t index = oldest; index < mTickCount; ++index)
+            {
+                const TickRecord &record = mTicks[index % kCapacity];
+                if (record.tick < nextTick)
+                    continue;
+
+                std::fprintf(file, "%llu,%u,%u,%llu,%.4f", static_cast<unsigned long long>(record.tick),
+                             record.entities, record.food, static_cast<unsigned long long>(record.allocations),
+                             record.totalMs);
+                for (float milliseconds : record.phaseMs)
+                {
+                    std::fprintf(file, ",%.4f", milliseconds);
+                }
+                std::fputc('\n', file);
+
+                nextTick = record.tick + 1;
+                written++;
+            }
+            return written;
+        }
+
+        // 🎨 LÉGENDE
+        const char *Profiler::GetPhaseName(ProfilePhase phase)
+        {
+            static const char *const names[kPhaseCount] = {
+                "movement", "spatial_index", "steering", "eating",
+                "reproduction", "culling", "plant_growth", "statistics"};
+            return names[static_cast<std::size_t>(phase)];
+        }
+
+        Color Profiler::GetPhaseColor(ProfilePhase phase)
+        {
+            static const Color colors[kPhaseCount] = {
+                Color(80, 160, 255),  // Mouvement : bleu
+                Color(160, 160, 160), // Grilles : gris
+                Color(0, 200, 200),   // Pilotage : cyan
+                Color(0, 200, 0),     // Repas : vert
+                Color(255, 120, 200), // Reproduction : rose
+                Color(255, 60, 60),   // Retrait des morts : rouge
+                Color(120, 90, 40),   // Plantes : brun
+                Color(255, 255, 0)};  // Statistiques : jaune
+            return colors[static_cast<std::size_t>(phase)];
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
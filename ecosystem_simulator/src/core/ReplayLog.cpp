@@ -0,0 +1,238 @@
+#include "Core/ReplayLog.h"
+#include "Core/Ecosystem.h"
+#include "Core/Logger.h"
+#include "Core/Snapshot.h"
+#include <cstring> // Pour std::memcpy, std::memcmp
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        namespace
+        {
+            constexpr char kMagic[8] = {'E', 'C', 'O', 'R', 'E', 'P', 'L', 'Y'};
+
+            struct ReplayHeader
+            {
+                char magic[8];
+                uint32_t version;
+                float timeStep;
+                uint64_t seed;
+                int64_t startTick;
+                uint64_t startHash;
+            };
+
+            enum class EntryKind : uint8_t
+            {
+                Tick,
+                Command
+            };
+
+            // Une entrée de taille fixe par tick ou par commande
+            struct ReplayEntry
+            {
+                EntryKind kind;
+                uint8_t command;
+                uint16_t reserved;
+                int32_t value; // Argument de la commande, ou nourriture restante après le tick
+                int64_t tick;
+                uint64_t hash;
+                uint32_t entities;
+                uint32_t births;
+                uint32_t deaths;
+                uint32_t meals;
+            };
+
+            static_assert(sizeof(ReplayEntry) == 40, "Entrée du journal : 40 octets");
+        }
+
+        ReplayLog::~ReplayLog()
+        {
+            Close();
+        }
+
+        // 🔴 ENREGISTREMENT
+        bool ReplayLog::Open(const std::string &path, const Ecosystem &ecosystem, float timeStep)
+        {
+            Close();
+            mFile = std::fopen(path.c_str(), "wb");
+            if (!mFile)
+            {
+                ECO_LOG_ERROR("❌ Impossible d'écrire le journal de rejeu %s", path.c_str());
+                return false;
+            }
+
+            ReplayHeader header = {};
+            std::memcpy(header.magic, kMagic, sizeof(kMagic));
+            header.version = kVersion;
+            header.timeStep = timeStep;
+            header.seed = ecosystem.GetSeed();
+            header.startTick = ecosystem.GetDayCycle();
+            header.startHash = ecosystem.ComputeStateHash();
+            std::fwrite(&header, sizeof(header), 1, mFile);
+
+            ECO_LOG_INFO("🔴 Enregistrement du journal de rejeu: %s (graine %llu)", path.c_str(),
+                         static_cast<unsigned long long>(header.seed));
+            return true;
+        }
+
+        void ReplayLog::Close()
+        {
+            if (mFile)
+            {
+                std::fclose(mFile);
+                mFile = nullptr;
+            }
+        }
+
+        void ReplayLog::RecordCommand(const Ecosystem &ecosystem, Command command, int32_t argument)
+        {
+            if (!mFile)
+                return;
+            ReplayEntry entry = {};
+            entry.kind = EntryKind::Command;
+            entry.command = static_cast<uint8_t>(command);
+            entry.value = argument;
+            entry.tick = ecosystem.GetDayCycle();
+            std::fwrite(&entry, sizeof(entry), 1, mFile);
+        }
+
+        void ReplayLog::RecordTick(const Ecosystem &ecosystem)
+        {
+            if (!mFile)
+                return;
+            const Ecosystem::TickEvents &events = ecosystem.GetTickEvents();
+            ReplayEntry entry = {};
+            entry.kind = EntryKind::Tick;
+            entry.value = ecosystem.GetFoodCount();
+            entry.tick = ecosystem.GetDayCycle() - 1; // Update a déjà avancé le compteur
+            entry.hash = ecosystem.ComputeStateHash();
+            entry.entities = static_cast<uint32_t>(ecosystem.GetEntityCount());
+            entry.births = events.births;
+            entry.deaths = events.deaths;
+            entry.meals = events.meals;
+            std::fwrite(&entry, sizeof(entry), 1, mFile);
+        }
+
+        // 🎮 APPLICATION D'UNE COMMANDE
+        void ReplayLog::Apply(Ecosystem &ecosystem, Command command, int32_t argument)
+        {
+            switch (command)
+            {
+            case Command::Reset:
+                ecosystem.Initialize();
+                break;
+            case Command::SpawnFood:
+                ecosystem.SpawnFood(argument);
+                break;
+            case Command::LoadSnapshot:
+                break; // Chargée par l'appelant (le fichier n'est pas dans le journal)
+            }
+        }
+
+        // ▶ REJEU
+        ReplayLog::Result ReplayLog::Replay(Ecosystem &ecosystem, const std::string &path, const std::string &startSnapshot)
+        {
+            Result result;
+            std::FILE *file = std::fopen(path.c_str(), "rb");
+            if (!file)
+            {
+                result.error = "journal introuvable";
+                return result;
+            }
+
+            ReplayHeader header;
+            if (std::fread(&header, sizeof(header), 1, file) != 1 || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+            {
+                std::fclose(file);
+                result.error = "ce fichier n'est pas un journal de rejeu";
+                return result;
+            }
+            if (header.version != kVersion)
+            {
+                std::fclose(file);
+                result.error = "version du journal non prise en charge";
+                return result;
+            }
+
+            // Même départ que l'enregistrement
+            ecosystem.SetSeed(header.seed);
+            ecosystem.Initialize();
+            if (!startSnapshot.empty() && !Snapshot::Load(ecosystem, startSnapshot))
+            {
+                std::fclose(file);
+                result.error = "sauvegarde de départ illisible";
+                return result;
+            }
+            result.actualHash = ecosystem.ComputeStateHash();
+            if (ecosystem.GetDayCycle() != header.startTick || result.actualHash != header.startHash)
+            {
+                std::fclose(file);
+                result.divergentTick = -2;
+                result.expectedHash = header.startHash;
+                result.error = "état de départ différent (même configuration et même sauvegarde de départ ?)";
+                return result;
+            }
+
+            ReplayEntry entry;
+            while (std::fread(&entry, sizeof(entry), 1, file) == 1)
+            {
+                if (entry.kind == EntryKind::Command)
+                {
+                    Command command = static_cast<Command>(entry.command);
+                    if (command == Command::LoadSnapshot)
+                    {
+                        result.incomplete = true;
+                        break;
+                    }
+                    Apply(ecosystem, command, entry.value);
+                    continue;
+                }
+
+                ecosystem.Update(header.timeStep);
+                result.actualHash = ecosystem.ComputeStateHash();
+                if (result.actualHash != entry.hash)
+                {
+                    const Ecosystem::TickEvents &events = ecosystem.GetTickEvents();
+                    result.divergentTick = entry.tick;
+                    result.expectedHash = entry.hash;
+                    ECO_LOG_ERROR("   Tick %lld attendu: %u entités, %d nourritures, %u naissances, %u morts, %u repas",
+                                  static_cast<long long>(entry.tick), entry.entities, entry.value,
+                                  entry.births, entry.deaths, entry.meals);
+                    ECO_LOG_ERROR("   Tick %lld obtenu : %d entités, %d nourritures, %u naissances, %u morts, %u repas",
+                                  static_cast<long long>(entry.tick), ecosystem.GetEntityCount(), ecosystem.GetFoodCount(),
+                                  events.births, events.deaths, events.meals);
+                    break;
+                }
+                result.ticks++;
+            }
+            std::fclose(file);
+
+            result.ok = result.divergentTick == -1;
+            return result;
+        }
+
+        // 📊 AFFICHAGE DU RÉSULTAT
+        void ReplayLog::PrintResult(const Result &result)
+        {
+            if (!result.error.empty())
+            {
+                ECO_LOG_ERROR("❌ Rejeu impossible: %s", result.error.c_str());
+            }
+            else if (result.ok)
+            {
+                ECO_LOG_INFO("✅ Rejeu identique: %lld ticks vérifiés%s", static_cast<long long>(result.ticks),
+                             result.incomplete ? " (arrêt sur un chargement de sauvegarde)" : "");
+            }
+            else
+            {
+                ECO_LOG_ERROR("❌ Divergence au tick %lld après %lld ticks identiques (empreinte %016llx au lieu de %016llx)",
+                              static_cast<long long>(result.divergentTick), static_cast<long long>(result.ticks),
+                              static_cast<unsigned long long>(result.actualHash),
+                              static_cast<unsigned long long>(result.expectedHash));
+            }
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,79 @@
+#include "Core/ScratchArena.h"
+#include <algorithm> // Pour std::max
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🏗 CONSTRUCTEUR
+        ScratchArena::ScratchArena(std::size_t initialCapacity)
+            : mOffset(0), mUsedBytes(0), mPeakBytes(0)
+        {
+            AddBlock(initialCapacity);
+        }
+
+        // 📥 ALLOCATION PAR INCRÉMENT
+        void *ScratchArena::AllocateBytes(std::size_t bytes, std::size_t alignment)
+        {
+            mUsedBytes += bytes;
+
+            std::size_t aligned = (mOffset + alignment - 1) & ~(alignment - 1);
+            if (aligned + bytes > mBlocks.back().capacity)
+            {
+                // Bloc plein : on en ouvre un autre pour ce tick, ils seront fusionnés au Reset
+                AddBlock(bytes + alignment);
+                aligned = 0;
+            }
+
+            mOffset = aligned + bytes;
+            return mBlocks.back().data.get() + aligned;
+        }
+
+        // 🔄 REMISE À ZÉRO (début de tick)
+        void ScratchArena::Reset()
+        {
+            mPeakBytes = std::max(mPeakBytes, mUsedBytes);
+
+            // Le tick a débordé sur plusieurs blocs : on les remplace par un seul bloc
+            // assez grand pour le pire tick, afin que le suivant tienne d'un seul tenant
+            if (mBlocks.size() > 1)
+            {
+                std::size_t capacity = GetCapacity();
+                mBlocks.clear();
+                AddBlock(capacity);
+            }
+
+            mOffset = 0;
+            mUsedBytes = 0;
+        }
+
+        std::size_t ScratchArena::GetCapacity() const
+        {
+            std::size_t capacity = 0;
+            for (const Block &block : mBlocks)
+            {
+                capacity += block.capacity;
+            }
+            return capacity;
+        }
+
+        // ➕ NOUVEAU BLOC (au moins le double du précédent)
+        void ScratchArena::AddBlock(std::size_t minimumBytes)
+        {
+            std::size_t capacity = minimumBytes;
+            if (!mBlocks.empty())
+            {
+                capacity = std::max(capacity, mBlocks.back().capacity * 2);
+            }
+            capacity = std::max<std::size_t>(capacity, 64);
+
+            Block block;
+            block.data.reset(new unsigned char[capacity]);
+            block.capacity = capacity;
+            mBlocks.push_back(std::move(block));
+            mOffset = 0;
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
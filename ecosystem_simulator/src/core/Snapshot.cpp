@@ -0,0 +1,406 @@
+#include "Core/Snapshot.h"
+#include "Core/Ecosystem.h"
+#include "Core/Logger.h"
+#include <cstdio>  // Pour std::fopen, std::rename
+#include <cstring> // Pour std::memcpy
+#include <type_traits>
+#include <utility> // Pour std::move
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ECOSYSTEM_SNAPSHOT_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        namespace
+        {
+            constexpr char kMagic[8] = {'E', 'C', 'O', 'S', 'N', 'A', 'P', '\0'};
+            constexpr uint32_t kByteOrderMark = 0x01020304u;
+            constexpr std::size_t kSectionAlignment = 64;
+
+            // 📋 EN-TÊTE (taille fixe, en début de fichier)
+            struct SnapshotHeader
+            {
+                char magic[8];
+                uint32_t version;
+                uint32_t byteOrder;
+                uint64_t fileSize;
+                uint64_t entityCount;
+                uint64_t foodCount;
+                uint64_t labelCount; // Table des étiquettes (EntityStore::GetLabels)
+                uint64_t labelBytes;
+
+                // Hasard et temps
+                uint64_t seed;
+                uint64_t worldDraws;
+                uint64_t nextId;
+                int64_t dayCycle;
+
+                float worldWidth;
+                float worldHeight;
+                int32_t stats[6]; // Ecosystem::Statistics, dans l'ordre des champs
+            };
+
+            static_assert(std::is_trivially_copyable<Food>::value, "Food est écrit tel quel");
+            static_assert(std::is_trivially_copyable<Color>::value, "Color est écrit tel quel");
+
+            std::size_t AlignSection(std::size_t offset)
+            {
+                return (offset + kSectionAlignment - 1) / kSectionAlignment * kSectionAlignment;
+            }
+
+            // Taille totale attendue d'après l'en-tête (mêmes règles d'alignement que l'écriture).
+            // Au chargement, les nombres de l'en-tête sont d'abord bornés par la taille du
+            // fichier (voir HasPlausibleCounts) : le calcul ne peut pas déborder.
+            std::size_t ExpectedFileSize(const EntityStore &store, const SnapshotHeader &header)
+            {
+                std::size_t offset = sizeof(SnapshotHeader);
+                EntityStore::ForEachPersistentColumn(store, [&](const auto &column)
+                              { offset = AlignSection(offset) + header.entityCount * sizeof(column[0]); });
+                offset = AlignSection(offset) + (header.labelCount + 1) * sizeof(uint32_t); // Début de chaque étiquette
+                offset = AlignSection(offset) + header.labelBytes;
+                offset = AlignSection(offset) + header.foodCount * sizeof(Food);
+                return offset;
+            }
+
+            // Chaque élément occupe au moins un octet : aucun nombre ne peut dépasser la taille
+            // du fichier (un en-tête corrompu ferait sinon déborder ExpectedFileSize)
+            bool HasPlausibleCounts(const SnapshotHeader &header, std::size_t fileSize)
+            {
+                return header.entityCount <= fileSize && header.foodCount <= fileSize &&
+                       header.labelCount < fileSize && header.labelBytes <= fileSize;
+            }
+
+            // ✍ ÉCRITURE D'UNE SECTION, PRÉCÉDÉE DU REMPLISSAGE D'ALIGNEMENT
+            class SectionWriter
+            {
+            public:
+                explicit SectionWriter(std::FILE *file) : mFile(file), mOffset(0), mOk(true) {}
+
+                void Write(const void *data, std::size_t bytes)
+                {
+                    if (bytes > 0 && std::fwrite(data, 1, bytes, mFile) != bytes)
+                        mOk = false;
+                    mOffset += bytes;
+                }
+
+                void Section(const void *data, std::size_t bytes)
+                {
+                    static const char kPadding[kSectionAlignment] = {};
+                    Write(kPadding, AlignSection(mOffset) - mOffset);
+                    Write(data, bytes);
+                }
+
+                std::size_t GetOffset() const { return mOffset; }
+                bool IsOk() const { return mOk; }
+
+            private:
+                std::FILE *mFile;
+                std::size_t mOffset;
+                bool mOk;
+            };
+
+            // 🗺 FICHIER PROJETÉ EN MÉMOIRE (lecture seule)
+            class MappedFile
+            {
+            public:
+                MappedFile() = default;
+                MappedFile(const MappedFile &) = delete;
+                MappedFile &operator=(const MappedFile &) = delete;
+
+                ~MappedFile()
+                {
+#if defined(ECOSYSTEM_SNAPSHOT_MMAP)
+                    if (mMapping)
+                        munmap(mMapping, mSize);
+#endif
+                }
+
+                bool Open(const std::string &path)
+                {
+#if defined(ECOSYSTEM_SNAPSHOT_MMAP)
+                    int descriptor = open(path.c_str(), O_RDONLY);
+                    if (descriptor < 0)
+                        return false;
+                    struct stat info;
+                    if (fstat(descriptor, &info) == 0 && info.st_size > 0)
+                    {
+                        void *mapping = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+                        if (mapping != MAP_FAILED)
+                        {
+                            madvise(mapping, static_cast<std::size_t>(info.st_size), MADV_SEQUENTIAL);
+                            mMapping = mapping;
+                            mData = static_cast<const uint8_t *>(mapping);
+                            mSize = static_cast<std::size_t>(info.st_size);
+                        }
+                    }
+                    close(descriptor); // La projection reste valide après la fermeture
+                    if (mData)
+                        return true;
+#endif
+                    // Repli : lecture complète du fichier
+                    std::FILE *file = std::fopen(path.c_str(), "rb");
+                    if (!file)
+                        return false;
+                    std::fseek(file, 0, SEEK_END);
+                    long size = std::ftell(file);
+                    std::fseek(file, 0, SEEK_SET);
+                    if (size > 0)
+                    {
+                        mBuffer.resize(static_cast<std::size_t>(size));
+                        if (std::fread(mBuffer.data(), 1, mBuffer.size(), file) != mBuffer.size())
+                            mBuffer.clear();
+                    }
+                    std::fclose(file);
+                    mData = mBuffer.data();
+                    mSize = mBuffer.size();
+                    return mSize > 0;
+                }
+
+                const uint8_t *GetData() const { return mData; }
+                std::size_t GetSize() const { return mSize; }
+
+            private:
+                const uint8_t *mData = nullptr;
+                std::size_t mSize = 0;
+                void *mMapping = nullptr;
+                std::vector<uint8_t> mBuffer;
+            };
+        }
+
+        // 💾 SAUVEGARDE
+        bool Snapshot::Save(const Ecosystem &ecosystem, const std::string &path)
+        {
+            const EntityStore &store = ecosystem.mEntities;
+            std::size_t count = store.Size();
+
+            // Table des étiquettes : index de début de chaque étiquette, puis tous les caractères
+            const std::vector<std::string> &labels = store.GetLabels();
+            std::vector<uint32_t> labelOffsets(labels.size() + 1);
+            std::size_t labelBytes = 0;
+            for (std::size_t l = 0; l < labels.size(); ++l)
+            {
+                labelOffsets[l] = static_cast<uint32_t>(labelBytes);
+                labelBytes += labels[l].size();
+            }
+            labelOffsets[labels.size()] = static_cast<uint32_t>(labelBytes);
+            std::vector<char> labelText(labelBytes);
+            for (std::size_t l = 0; l < labels.size(); ++l)
+            {
+                std::memcpy(labelText.data() + labelOffsets[l], labels[l].data(), labels[l].size());
+            }
+
+            SnapshotHeader header = {};
+            std::memcpy(header.magic, kMagic, sizeof(kMagic));
+            header.version = kVersion;
+            header.byteOrder = kByteOrderMark;
+            header.entityCount = count;
+            header.foodCount = ecosystem.mFoodSources.size();
+            header.labelCount = labels.size();
+            header.labelBytes = labelBytes;
+            header.seed = store.random.GetSeed();
+            header.worldDraws = ecosystem.mWorldDraws;
+            header.nextId = store.nextId;
+            header.dayCycle = ecosystem.mDayCycle;
+            header.worldWidth = ecosystem.mConfig.worldWidth;
+            header.worldHeight = ecosystem.mConfig.worldHeight;
+            const Ecosystem::Statistics &stats = ecosystem.mStats;
+            int32_t statValues[6] = {stats.totalHerbivores, stats.totalCarnivores, stats.totalPlants,
+                                     stats.totalFood, stats.deathsToday, stats.birthsToday};
+            std::memcpy(header.stats, statValues, sizeof(statValues));
+            header.fileSize = ExpectedFileSize(store, header);
+
+            // Écriture dans un fichier temporaire, renommé à la fin
+            std::string temporaryPath = path + ".tmp";
+            std::FILE *file = std::fopen(temporaryPath.c_str(), "wb");
+            if (!file)
+            {
+                ECO_LOG_ERROR("❌ Impossible d'écrire la sauvegarde %s", temporaryPath.c_str());
+                return false;
+            }
+            std::setvbuf(file, nullptr, _IOFBF, 1 << 20);
+
+            SectionWriter writer(file);
+            writer.Write(&header, sizeof(header));
+            EntityStore::ForEachPersistentColumn(store, [&](const auto &column)
+                          { writer.Section(column.data(), count * sizeof(column[0])); });
+            writer.Section(labelOffsets.data(), labelOffsets.size() * sizeof(uint32_t));
+            writer.Section(labelText.data(), labelText.size());
+            writer.Section(ecosystem.mFoodSources.data(), ecosystem.mFoodSources.size() * sizeof(Food));
+
+            bool ok = writer.IsOk() && writer.GetOffset() == header.fileSize;
+            ok = std::fclose(file) == 0 && ok;
+            if (!ok || std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+            {
+                std::remove(temporaryPath.c_str());
+                ECO_LOG_ERROR("❌ Échec de l'écriture de la sauvegarde %s", path.c_str());
+                return false;
+            }
+
+            ECO_LOG_INFO("💾 Sauvegarde écrite: %s (tick %d, %zu entités, %zu nourritures, %zu octets)", path.c_str(),
+                         ecosystem.mDayCycle, count, ecosystem.mFoodSources.size(), static_cast<std::size_t>(header.fileSize));
+            return true;
+        }
+
+        // 📂 CHARGEMENT
+        bool Snapshot::Load(Ecosystem &ecosystem, const std::string &path)
+        {
+            MappedFile file;
+            if (!file.Open(path))
+            {
+                ECO_LOG_ERROR("❌ Sauvegarde introuvable ou vide: %s", path.c_str());
+                return false;
+            }
+
+            // 1) Vérifications, avant de toucher à l'écosystème
+            SnapshotHeader header;
+            if (file.GetSize() < sizeof(header))
+            {
+                ECO_LOG_ERROR("❌ %s n'est pas une sauvegarde (fichier trop court)", path.c_str());
+                return false;
+            }
+            std::memcpy(&header, file.GetData(), sizeof(header));
+            if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0)
+            {
+                ECO_LOG_ERROR("❌ %s n'est pas une sauvegarde", path.c_str());
+                return false;
+            }
+            if (header.byteOrder != kByteOrderMark || header.version != kVersion)
+            {
+                ECO_LOG_ERROR("❌ %s: format %u non pris en charge (attendu %u, même ordre des octets)", path.c_str(),
+                              header.version, kVersion);
+                return false;
+            }
+
+            EntityStore &store = ecosystem.mEntities;
+            if (header.fileSize != file.GetSize() || !HasPlausibleCounts(header, file.GetSize()) ||
+                ExpectedFileSize(store, header) != file.GetSize())
+            {
+                ECO_LOG_ERROR("❌ %s: sauvegarde tronquée ou corrompue", path.c_str());
+                return false;
+            }
+
+            const WorldConfig &config = ecosystem.mConfig;
+            if (header.worldWidth != config.worldWidth || header.worldHeight != config.worldHeight)
+            {
+                ECO_LOG_ERROR("❌ %s: monde de %gx%g, la configuration en décrit un de %gx%g (world_width/world_height)",
+                              path.c_str(), header.worldWidth, header.worldHeight, config.worldWidth, config.worldHeight);
+                return false;
+            }
+            if (header.entityCount > static_cast<uint64_t>(config.maxEntities) ||
+                (config.maxFood > 0 && header.foodCount > static_cast<uint64_t>(config.maxFood)))
+            {
+                ECO_LOG_ERROR("❌ %s: %llu entités et %llu nourritures, au-delà de max_entities/max_food", path.c_str(),
+                              static_cast<unsigned long long>(header.entityCount),
+                              static_cast<unsigned long long>(header.foodCount));
+                return false;
+            }
+
+            std::size_t count = static_cast<std::size_t>(header.entityCount);
+            std::size_t offset = sizeof(SnapshotHeader);
+            std::size_t lastColumn = offset;
+            std::size_t typeColumn = offset;
+            std::size_t aliveColumn = offset;
+            EntityStore::ForEachPersistentColumn(store, [&](const auto &column)
+                          {
+                              lastColumn = AlignSection(offset);
+                              if (static_cast<const void *>(&column) == &store.type)
+                                  typeColumn = lastColumn;
+                              if (static_cast<const void *>(&column) == &store.alive)
+                                  aliveColumn = lastColumn;
+                              offset = lastColumn + count * sizeof(column[0]); });
+
+            // Espèces et drapeaux de vie : ils servent d'index (table des espèces, recensement).
+            // Une sauvegarde est écrite entre deux ticks, après le retrait des morts : une entité
+            // morte ne serait jamais retirée après chargement.
+            static_assert(sizeof(EntityType) == 1 && sizeof(store.alive[0]) == 1, "Colonnes d'un octet");
+            const uint8_t *types = file.GetData() + typeColumn;
+            const uint8_t *alive = file.GetData() + aliveColumn;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (types[i] >= kSpeciesCount || alive[i] != 1)
+                {
+                    ECO_LOG_ERROR("❌ %s: entité %zu invalide (espèce %u, vivante %u)", path.c_str(), i,
+                                  static_cast<unsigned>(types[i]), static_cast<unsigned>(alive[i]));
+                    return false;
+                }
+            }
+
+            offset = AlignSection(offset);
+            std::size_t labelCount = static_cast<std::size_t>(header.labelCount);
+            std::vector<uint32_t> labelOffsets(labelCount + 1);
+            std::memcpy(labelOffsets.data(), file.GetData() + offset, labelOffsets.size() * sizeof(uint32_t));
+            bool labelsOk = labelCount > 0 && labelOffsets[labelCount] == header.labelBytes;
+            for (std::size_t l = 0; labelsOk && l < labelCount; ++l)
+            {
+                labelsOk = labelOffsets[l] <= labelOffsets[l + 1];
+            }
+            // La dernière colonne est celle des étiquettes : chaque index doit exister
+            for (std::size_t i = 0; labelsOk && i < count; ++i)
+            {
+                uint32_t labelIndex;
+                std::memcpy(&labelIndex, file.GetData() + lastColumn + i * sizeof(uint32_t), sizeof(labelIndex));
+                labelsOk = labelIndex < labelCount;
+            }
+            if (!labelsOk)
+            {
+                ECO_LOG_ERROR("❌ %s: table des étiquettes corrompue", path.c_str());
+                return false;
+            }
+
+            // 2) Copie des tableaux, un memcpy par colonne
+            store.Resize(count);
+            offset = sizeof(SnapshotHeader);
+            EntityStore::ForEachPersistentColumn(store, [&](auto &column)
+                          {
+                              offset = AlignSection(offset);
+                              std::size_t bytes = count * sizeof(column[0]);
+                              if (bytes > 0)
+                                  std::memcpy(column.data(), file.GetData() + offset, bytes);
+                              offset += bytes; });
+            offset = AlignSection(offset) + labelOffsets.size() * sizeof(uint32_t);
+            offset = AlignSection(offset);
+            const char *labelText = reinterpret_cast<const char *>(file.GetData() + offset);
+            std::vector<std::string> labels(labelCount);
+            for (std::size_t l = 0; l < labelCount; ++l)
+            {
+                labels[l].assign(labelText + labelOffsets[l], labelOffsets[l + 1] - labelOffsets[l]);
+            }
+            store.SetLabels(std::move(labels));
+            offset = AlignSection(offset + static_cast<std::size_t>(header.labelBytes));
+
+            std::size_t foodCount = static_cast<std::size_t>(header.foodCount);
+            ecosystem.mFoodSources.assign(foodCount, Food(Vector2D()));
+            if (foodCount > 0)
+                std::memcpy(ecosystem.mFoodSources.data(), file.GetData() + offset, foodCount * sizeof(Food));
+
+            // 3) Hasard, temps et statistiques
+            store.random.SetSeed(header.seed);
+            store.nextId = header.nextId;
+            store.tick = static_cast<uint64_t>(header.dayCycle);
+            store.RebuildCensus();
+            ecosystem.mStaticDirty.MarkAll();
+            for (std::size_t i = 0; i < store.Size(); ++i)
+                ecosystem.TrackStaticTint(i);
+            ecosystem.mWorldDraws = header.worldDraws;
+            ecosystem.mDayCycle = static_cast<int>(header.dayCycle);
+            ecosystem.mStats = {header.stats[0], header.stats[1], header.stats[2],
+                                header.stats[3], header.stats[4], header.stats[5]};
+            ecosystem.mDeadEntities.clear();
+            ecosystem.RebuildSpatialIndex(); // Pour le rendu ; le prochain tick la refait de toute façon
+
+            ECO_LOG_INFO("📂 Sauvegarde chargée: %s (tick %d, %zu entités, %zu nourritures, graine %llu)", path.c_str(),
+                         ecosystem.mDayCycle, count, foodCount, static_cast<unsigned long long>(header.seed));
+            return true;
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
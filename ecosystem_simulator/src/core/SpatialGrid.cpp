@@ -0,0 +1,171 @@
+#include "Core/SpatialGrid.h"
+#include <cmath>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        // 🏗 CONSTRUCTEUR
+        SpatialGrid::SpatialGrid(float worldWidth, float worldHeight, float cellSize)
+            : mCellSize(1.0f), mInverseCellSize(1.0f), mColumns(1), mRows(1)
+        {
+            Configure(worldWidth, worldHeight, cellSize);
+        }
+
+        // ⚙ CONFIGURATION
+        void SpatialGrid::Configure(float worldWidth, float worldHeight, float cellSize)
+        {
+            mCellSize = cellSize > 0.0f ? cellSize : 1.0f;
+            mInverseCellSize = 1.0f / mCellSize;
+            mColumns = std::max(1, static_cast<int>(std::ceil(worldWidth / mCellSize)));
+            mRows = std::max(1, static_cast<int>(std::ceil(worldHeight / mCellSize)));
+
+            mCellStart.assign(static_cast<std::size_t>(mColumns) * mRows + 1, 0);
+            mItems.clear();
+            mItemX.clear();
+            mItemY.clear();
+        }
+
+        // 🔄 RECONSTRUCTION À PARTIR DES TABLEAUX D'ENTITÉS
+        void SpatialGrid::Build(const std::vector<float> &positionsX, const std::vector<float> &positionsY, std::size_t count)
+        {
+            BeginBuild(count);
+            if (count > 0)
+            {
+                FinishBuild(positionsX.data(), positionsY.data(), 1);
+            }
+        }
+
+        // 🔄 RECONSTRUCTION À PARTIR DE LA NOURRITURE
+        void SpatialGrid::Build(const std::vector<Food> &foodSources)
+        {
+            BeginBuild(foodSources.size());
+            if (!foodSources.empty())
+            {
+                // Les positions sont lues directement dans le vecteur de Food (pas de copie)
+                static_assert(sizeof(Food) % sizeof(float) == 0, "Food doit être aligné sur des float");
+                FinishBuild(&foodSources[0].position.x, &foodSources[0].position.y,
+                            sizeof(Food) / sizeof(float));
+            }
+        }
+
+        void SpatialGrid::BeginBuild(std::size_t count)
+        {
+            std::fill(mCellStart.begin(), mCellStart.end(), 0);
+            mItems.resize(count);
+            mItemX.resize(count);
+            mItemY.resize(count);
+            mItemCell.resize(count);
+        }
+
+        // Tri par comptage : 1) compter par cellule 2) cumuler 3) ranger
+        void SpatialGrid::FinishBuild(const float *positionsX, const float *positionsY, std::size_t stride)
+        {
+            std::size_t count = mItems.size();
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uint32_t cell = static_cast<uint32_t>(CellRow(positionsY[i * stride]) * mColumns +
+                                                      CellColumn(positionsX[i * stride]));
+                mItemCell[i] = cell;
+                mCellStart[cell + 1]++;
+            }
+
+            for (std::size_t cell = 1; cell < mCellStart.size(); ++cell)
+            {
+                mCellStart[cell] += mCellStart[cell - 1];
+            }
+
+            // On se sert de mItemCell comme "curseur d'écriture" par cellule : on le remplace
+            // par la position finale de chaque élément (l'ordre des index est conservé)
+            std::vector<uint32_t> &cursor = mItemCell;
+            mCellCursor.assign(mCellStart.begin(), mCellStart.end() - 1);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                cursor[i] = mCellCursor[cursor[i]]++;
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uint32_t slot = cursor[i];
+                mItems[slot] = static_cast<uint32_t>(i);
+                mItemX[slot] = positionsX[i * stride];
+                mItemY[slot] = positionsY[i * stride];
+            }
+        }
+
+        // 🔍 RECHERCHE DANS UN RAYON
+        void SpatialGrid::QueryRadius(Vector2D center, float radius, std::vector<std::size_t> &results) const
+        {
+            ForEachInRadius(center, radius, [&results](std::size_t index, float)
+                            { results.push_back(index); });
+        }
+
+        // 🔍 RECHERCHE DES K PLUS PROCHES VOISINS
+        // On explore des "anneaux" de cellules de plus en plus larges autour du centre.
+        // Dès que le k-ième voisin trouvé est plus proche que l'anneau suivant, on s'arrête.
+        void SpatialGrid::QueryNearest(Vector2D center, std::size_t k, float maxRadius, std::vector<std::size_t> &results) const
+        {
+            results.clear();
+            if (k == 0 || mItems.empty())
+                return;
+
+            // Paires (distanceCarrée, index) triées, au plus k éléments
+            std::vector<std::pair<float, std::size_t>> best;
+            best.reserve(k + 1);
+            float maxRadiusSquared = maxRadius * maxRadius;
+
+            int centerColumn = CellColumn(center.x);
+            int centerRow = CellRow(center.y);
+            int maxRing = std::max(mColumns, mRows);
+
+            for (int ring = 0; ring <= maxRing; ++ring)
+            {
+                for (int row = centerRow - ring; row <= centerRow + ring; ++row)
+                {
+                    if (row < 0 || row >= mRows)
+                        continue;
+                    for (int column = centerColumn - ring; column <= centerColumn + ring; ++column)
+                    {
+                        if (column < 0 || column >= mColumns)
+                            continue;
+                        // Seules les cellules sur le bord de l'anneau sont nouvelles
+                        if (row != centerRow - ring && row != centerRow + ring &&
+                            column != centerColumn - ring && column != centerColumn + ring)
+                            continue;
+
+                        std::size_t cell = static_cast<std::size_t>(row) * mColumns + column;
+                        for (uint32_t slot = mCellStart[cell]; slot < mCellStart[cell + 1]; ++slot)
+                        {
+                            float dx = mItemX[slot] - center.x;
+                            float dy = mItemY[slot] - center.y;
+                            std::pair<float, std::size_t> candidate(dx * dx + dy * dy, mItems[slot]);
+                            if (candidate.first > maxRadiusSquared)
+                                continue;
+                            if (best.size() == k && !(candidate < best.back()))
+                                continue;
+
+                            best.insert(std::upper_bound(best.begin(), best.end(), candidate), candidate);
+                            if (best.size() > k)
+                                best.pop_back();
+                        }
+                    }
+                }
+
+                // Tout élément non visité est à au moins ring * mCellSize du centre
+                float reached = ring * mCellSize;
+                if (reached > maxRadius)
+                    break;
+                if (best.size() == k && best.back().first <= reached * reached)
+                    break;
+            }
+
+            for (const auto &entry : best)
+            {
+                results.push_back(entry.second);
+            }
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
@@ -0,0 +1,188 @@
+#include "Core/StatisticsWriter.h"
+#include "Core/Logger.h"
+#include <cctype>  // Pour std::tolower
+#include <cstring> // Pour std::memcpy, std::strncpy
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        namespace
+        {
+            constexpr char kMagic[8] = {'E', 'C', 'O', 'S', 'T', 'A', 'T', 'S'};
+            constexpr std::size_t kColumnNameSize = 31;
+
+            enum class ColumnType : uint8_t
+            {
+                U32,
+                U64,
+                F32
+            };
+
+            struct ColumnHeader
+            {
+                char name[kColumnNameSize];
+                ColumnType type;
+            };
+
+            static_assert(sizeof(ColumnHeader) == 32, "Descripteur de colonne : 32 octets");
+
+            // 🗂 COLONNES DU FICHIER, DANS L'ORDRE
+            // "visit(nom, type, valeur(échantillon))" est appelé une fois par colonne ; le même
+            // parcours produit l'en-tête et les lots.
+            template <typename Visitor>
+            void ForEachColumn(Visitor visit)
+            {
+                visit("tick", ColumnType::U64, [](const StatisticsSample &s)
+                      { return s.tick; });
+                for (std::size_t t = 0; t < kSpeciesCount; ++t)
+                {
+                    std::string species = kDefaultSpecies[t].name;
+                    for (char &c : species)
+                        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+                    visit("population_" + species, ColumnType::U32, [t](const StatisticsSample &s)
+                          { return s.population[t]; });
+                    visit("mean_energy_" + species, ColumnType::F32, [t](const StatisticsSample &s)
+                          { return s.meanEnergy[t]; });
+                }
+                visit("births", ColumnType::U32, [](const StatisticsSample &s)
+                      { return s.births; });
+                visit("deaths", ColumnType::U32, [](const StatisticsSample &s)
+                      { return s.deaths; });
+                visit("meals", ColumnType::U32, [](const StatisticsSample &s)
+                      { return s.meals; });
+                visit("food", ColumnType::U32, [](const StatisticsSample &s)
+                      { return s.food; });
+            }
+        }
+
+        // 🏗 CONSTRUCTEUR
+        StatisticsWriter::StatisticsWriter()
+            : mFile(nullptr), mHasPending(false), mStopping(false)
+        {
+        }
+
+        StatisticsWriter::~StatisticsWriter()
+        {
+            Close();
+        }
+
+        // 📂 OUVERTURE : en-tête, puis démarrage du thread d'écriture
+        bool StatisticsWriter::Open(const std::string &path)
+        {
+            Close();
+            mFile = std::fopen(path.c_str(), "wb");
+            if (!mFile)
+            {
+                ECO_LOG_ERROR("❌ Impossible d'écrire les statistiques dans %s", path.c_str());
+                return false;
+            }
+
+            std::vector<ColumnHeader> columns;
+            ForEachColumn([&columns](const std::string &name, ColumnType type, auto)
+                          {
+                              ColumnHeader column = {};
+                              std::strncpy(column.name, name.c_str(), kColumnNameSize - 1);
+                              column.type = type;
+                              columns.push_back(column); });
+            uint32_t version = kVersion;
+            uint32_t columnCount = static_cast<uint32_t>(columns.size());
+            std::fwrite(kMagic, sizeof(kMagic), 1, mFile);
+            std::fwrite(&version, sizeof(version), 1, mFile);
+            std::fwrite(&columnCount, sizeof(columnCount), 1, mFile);
+            std::fwrite(columns.data(), sizeof(ColumnHeader), columns.size(), mFile);
+
+            mFilling.reserve(kBatchRows);
+            mPending.reserve(kBatchRows);
+            mHasPending = false;
+            mStopping = false;
+            mThread = std::thread(&StatisticsWriter::WriterLoop, this);
+
+            ECO_LOG_INFO("📈 Statistiques écrites dans %s (%u colonnes)", path.c_str(), columnCount);
+            return true;
+        }
+
+        void StatisticsWriter::Close()
+        {
+            if (!mFile)
+                return;
+
+            if (!mFilling.empty())
+                Submit();
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mStopping = true;
+            }
+            mCondition.notify_all();
+            mThread.join();
+
+            std::fclose(mFile);
+            mFile = nullptr;
+        }
+
+        // ✍ AJOUT D'UN ÉCHANTILLON
+        void StatisticsWriter::Append(const StatisticsSample &sample)
+        {
+            if (!mFile)
+                return;
+            mFilling.push_back(sample);
+            if (mFilling.size() >= kBatchRows)
+                Submit();
+        }
+
+        void StatisticsWriter::Submit()
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            // Le lot précédent doit être écrit avant d'en confier un autre
+            mCondition.wait(lock, [this]
+                            { return !mHasPending; });
+            mPending.swap(mFilling);
+            mFilling.clear();
+            mHasPending = true;
+            lock.unlock();
+            mCondition.notify_all();
+        }
+
+        // 🧵 THREAD D'ÉCRITURE
+        void StatisticsWriter::WriterLoop()
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            while (true)
+            {
+                mCondition.wait(lock, [this]
+                                { return mHasPending || mStopping; });
+                if (!mHasPending)
+                    break; // Arrêt demandé et plus rien à écrire
+
+                // Le lot en attente n'est touché que par ce thread tant que mHasPending est vrai
+                lock.unlock();
+                WriteBatch(mPending);
+                lock.lock();
+
+                mHasPending = false;
+                mCondition.notify_all();
+            }
+            std::fflush(mFile);
+        }
+
+        // Transposition d'un lot : chaque colonne est écrite d'un bloc
+        void StatisticsWriter::WriteBatch(const std::vector<StatisticsSample> &rows)
+        {
+            uint32_t rowCount = static_cast<uint32_t>(rows.size());
+            std::fwrite(&rowCount, sizeof(rowCount), 1, mFile);
+
+            ForEachColumn([this, &rows](const std::string &, ColumnType, auto value)
+                          {
+                              using Value = decltype(value(rows.front()));
+                              mColumn.resize(rows.size() * sizeof(Value));
+                              for (std::size_t r = 0; r < rows.size(); ++r)
+                              {
+                                  Value v = value(rows[r]);
+                                  std::memcpy(mColumn.data() + r * sizeof(Value), &v, sizeof(Value));
+                              }
+                              std::fwrite(mColumn.data(), 1, mColumn.size(), mFile); });
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
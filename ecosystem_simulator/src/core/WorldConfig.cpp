@@ -0,0 +1,279 @@
+#include "Core/WorldConfig.h"
+#include "Core/LodScheduler.h"
+#include "Core/Logger.h"
+#include "Core/PopulationCensus.h"
+#include <cctype> // Pour std::tolower
+#include <cmath>  // Pour std::isfinite
+#include <cerrno>
+#include <cstdio>  // Pour std::sscanf
+#include <cstdlib> // Pour std::strtof, std::strtol
+#include <fstream>
+
+namespace Ecosystem
+{
+    namespace Core
+    {
+
+        namespace
+        {
+            // Supprime les espaces au début et à la fin
+            std::string Trim(const std::string &text)
+            {
+                std::size_t first = text.find_first_not_of(" \t\r\n");
+                if (first == std::string::npos)
+                    return std::string();
+                std::size_t last = text.find_last_not_of(" \t\r\n");
+                return text.substr(first, last - first + 1);
+            }
+
+            // Conversions strictes : toute la valeur doit être lue (et "nan", "inf" sont refusés)
+            bool ParseFloat(const std::string &value, float &out)
+            {
+                char *end = nullptr;
+                errno = 0;
+                float parsed = std::strtof(value.c_str(), &end);
+                if (value.empty() || *end != '\0' || errno == ERANGE || !std::isfinite(parsed))
+                    return false;
+                out = parsed;
+                return true;
+            }
+
+            bool ParseInt(const std::string &value, int &out)
+            {
+                char *end = nullptr;
+                errno = 0;
+                long parsed = std::strtol(value.c_str(), &end, 10);
+                if (value.empty() || *end != '\0' || errno == ERANGE || parsed < -2147483647L || parsed > 2147483647L)
+                    return false;
+                out = static_cast<int>(parsed);
+                return true;
+            }
+
+            bool ParseUnsigned64(const std::string &value, uint64_t &out)
+            {
+                char *end = nullptr;
+                errno = 0;
+                unsigned long long parsed = std::strtoull(value.c_str(), &end, 10);
+                if (value.empty() || value[0] == '-' || *end != '\0' || errno == ERANGE)
+                    return false;
+                out = static_cast<uint64_t>(parsed);
+                return true;
+            }
+
+            // "r g b" ou "r,g,b" (0 à 255)
+            bool ParseColor(const std::string &value, Color &out)
+            {
+                unsigned r, g, b;
+                char extra;
+                if (std::sscanf(value.c_str(), "%u%*[ ,]%u%*[ ,]%u %c", &r, &g, &b, &extra) != 3 || r > 255 || g > 255 || b > 255)
+                    return false;
+                out = Color(static_cast<uint8_t>(r), static_cast<uint8_t>(g), static_cast<uint8_t>(b));
+                return true;
+            }
+
+            // 🧬 "herbivore.max_energy" : l'espèce est reconnue par son nom, sans tenir compte de la casse
+            bool SetSpeciesTrait(SpeciesTable &species, const std::string &speciesName, const std::string &trait,
+                                 const std::string &value)
+            {
+                for (SpeciesTraits &traits : species.traits)
+                {
+                    std::string name = traits.name;
+                    if (name.size() != speciesName.size())
+                        continue;
+                    bool same = true;
+                    for (std::size_t c = 0; c < name.size() && same; ++c)
+                        same = std::tolower(static_cast<unsigned char>(name[c])) == std::tolower(static_cast<unsigned char>(speciesName[c]));
+                    if (!same)
+                        continue;
+
+                    if (trait == "initial_energy")
+                        return ParseFloat(value, traits.initialEnergy);
+                    if (trait == "max_energy")
+                        return ParseFloat(value, traits.maxEnergy);
+                    if (trait == "max_age")
+                        return ParseInt(value, traits.maxAge);
+                    if (trait == "size")
+                        return ParseFloat(value, traits.size);
+                    if (trait == "color")
+                        return ParseColor(value, traits.color);
+                    if (trait == "metabolism")
+                        return ParseFloat(value, traits.metabolism);
+                    if (trait == "move_scale")
+                        return ParseFloat(value, traits.moveScale);
+                    if (trait == "move_cost")
+                        return ParseFloat(value, traits.moveCost);
+                    return false;
+                }
+                return false;
+            }
+        }
+
+        // 📄 LECTURE D'UN FICHIER
+        bool WorldConfig::LoadFile(const std::string &path)
+        {
+            std::ifstream file(path);
+            if (!file)
+            {
+                ECO_LOG_ERROR("❌ Configuration introuvable: %s", path.c_str());
+                return false;
+            }
+
+            bool ok = true;
+            std::string line;
+            int lineNumber = 0;
+            while (std::getline(file, line))
+            {
+                lineNumber++;
+                std::size_t comment = line.find('#');
+                if (comment != std::string::npos)
+                    line.erase(comment);
+                line = Trim(line);
+                if (line.empty())
+                    continue;
+
+                std::size_t equals = line.find('=');
+                if (equals == std::string::npos ||
+                    !Set(Trim(line.substr(0, equals)), Trim(line.substr(equals + 1))))
+                {
+                    ECO_LOG_ERROR("❌ %s:%d: ligne invalide \"%s\"", path.c_str(), lineNumber, line.c_str());
+                    ok = false;
+                }
+            }
+            return ok;
+        }
+
+        // ✏ MODIFICATION D'UNE CLÉ
+        bool WorldConfig::Set(const std::string &key, const std::string &value)
+        {
+            if (key == "world_width")
+                return ParseFloat(value, worldWidth);
+            if (key == "world_height")
+                return ParseFloat(value, worldHeight);
+            if (key == "window_width")
+                return ParseFloat(value, windowWidth);
+            if (key == "window_height")
+                return ParseFloat(value, windowHeight);
+            if (key == "boundary")
+            {
+                if (value == "reflect")
+                    boundary = BoundaryMode::Reflect;
+                else if (value == "wrap")
+                    boundary = BoundaryMode::Wrap;
+                else
+                    return false;
+                return true;
+            }
+            if (key == "max_entities")
+                return ParseInt(value, maxEntities);
+            if (key == "max_food")
+                return ParseInt(value, maxFood);
+            if (key == "initial_herbivores")
+                return ParseInt(value, initialHerbivores);
+            if (key == "initial_carnivores")
+                return ParseInt(value, initialCarnivores);
+            if (key == "initial_plants")
+                return ParseInt(value, initialPlants);
+            if (key == "initial_food")
+                return ParseInt(value, initialFood);
+            if (key == "food_energy")
+                return ParseFloat(value, foodEnergy);
+            if (key == "food_per_spawn")
+                return ParseInt(value, foodPerSpawn);
+            if (key == "plant_growth_chance")
+                return ParseFloat(value, plantGrowthChance);
+            if (key == "ticks_per_day")
+                return ParseInt(value, ticksPerDay);
+            if (key == "threads")
+                return ParseInt(value, threads);
+            if (key == "lod_interval")
+                return ParseInt(value, lodInterval);
+            std::size_t dot = key.find('.');
+            if (dot != std::string::npos)
+                return SetSpeciesTrait(species, key.substr(0, dot), key.substr(dot + 1), value);
+            if (key == "seed")
+            {
+                hasSeed = ParseUnsigned64(value, seed);
+                return hasSeed;
+            }
+            return false;
+        }
+
+        bool WorldConfig::SetFromAssignment(const std::string &assignment)
+        {
+            std::size_t equals = assignment.find('=');
+            if (equals == std::string::npos)
+                return false;
+            return Set(Trim(assignment.substr(0, equals)), Trim(assignment.substr(equals + 1)));
+        }
+
+        // ✅ COHÉRENCE
+        bool WorldConfig::Validate() const
+        {
+            bool ok = true;
+            if (worldWidth <= 0.0f || worldHeight <= 0.0f)
+            {
+                ECO_LOG_ERROR("❌ Taille du monde invalide: %gx%g", worldWidth, worldHeight);
+                ok = false;
+            }
+            if (windowWidth < 0.0f || windowHeight < 0.0f)
+            {
+                ECO_LOG_ERROR("❌ Taille de fenêtre invalide: %gx%g", windowWidth, windowHeight);
+                ok = false;
+            }
+            if (ticksPerDay <= 0)
+            {
+                ECO_LOG_ERROR("❌ ticks_per_day doit être positif: %d", ticksPerDay);
+                ok = false;
+            }
+            if (threads < 0)
+            {
+                ECO_LOG_ERROR("❌ Nombre de threads invalide: %d", threads);
+                ok = false;
+            }
+            if (!LodScheduler::IsValidInterval(lodInterval))
+            {
+                ECO_LOG_ERROR("❌ lod_interval doit être une puissance de 2 entre 1 et %d: %d", LodScheduler::kMaxInterval, lodInterval);
+                ok = false;
+            }
+            if (maxEntities <= 0 || maxFood < 0)
+            {
+                ECO_LOG_ERROR("❌ Limites invalides: max_entities=%d, max_food=%d", maxEntities, maxFood);
+                ok = false;
+            }
+            if (initialHerbivores < 0 || initialCarnivores < 0 || initialPlants < 0 || initialFood < 0)
+            {
+                ECO_LOG_ERROR("❌ Population de départ négative");
+                ok = false;
+            }
+            if (foodEnergy < 0.0f || foodPerSpawn < 0)
+            {
+                ECO_LOG_ERROR("❌ Nourriture invalide: food_energy=%g, food_per_spawn=%d", foodEnergy, foodPerSpawn);
+                ok = false;
+            }
+            if (!(plantGrowthChance >= 0.0f && plantGrowthChance <= 1.0f))
+            {
+                ECO_LOG_ERROR("❌ plant_growth_chance doit être entre 0 et 1: %g", plantGrowthChance);
+                ok = false;
+            }
+            for (const SpeciesTraits &traits : species.traits)
+            {
+                if (traits.maxEnergy <= 0.0f || traits.maxAge <= 0 || traits.size <= 0.0f || traits.moveScale < 0.0f)
+                {
+                    ECO_LOG_ERROR("❌ Caractéristiques invalides pour l'espèce %s", traits.name);
+                    ok = false;
+                }
+                if (traits.initialEnergy > PopulationCensus::kMaxEnergy || traits.maxEnergy > PopulationCensus::kMaxEnergy)
+                {
+                    ECO_LOG_ERROR("❌ Énergie trop grande pour l'espèce %s (maximum %g)", traits.name, PopulationCensus::kMaxEnergy);
+                    ok = false;
+                }
+            }
+            if (initialHerbivores + initialCarnivores + initialPlants > maxEntities)
+            {
+                ECO_LOG_WARNING("⚠ La population de départ dépasse max_entities=%d : elle sera tronquée", maxEntities);
+            }
+            return ok;
+        }
+
+    } // namespace Core
+} // namespace Ecosystem
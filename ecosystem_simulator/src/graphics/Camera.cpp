@@ -0,0 +1,76 @@
+#include "Graphics/Camera.h"
+#include <algorithm> // pour std::min, std::max
+
+namespace Ecosystem
+{
+    namespace Graphics
+    {
+
+        // 🏗 CONSTRUCTEUR
+        Camera::Camera()
+            : mWorldWidth(1.0f), mWorldHeight(1.0f), mViewportWidth(1.0f), mViewportHeight(1.0f), mMinScale(1.0f)
+        {
+        }
+
+        // ⚙ CONFIGURATION
+        void Camera::Configure(float worldWidth, float worldHeight, float viewportWidth, float viewportHeight)
+        {
+            mWorldWidth = std::max(worldWidth, 1.0f);
+            mWorldHeight = std::max(worldHeight, 1.0f);
+            mViewportWidth = std::max(viewportWidth, 1.0f);
+            mViewportHeight = std::max(viewportHeight, 1.0f);
+            // Jamais au-delà de kMaxScale, même pour un monde minuscule
+            mMinScale = std::min(std::min(mViewportWidth / mWorldWidth, mViewportHeight / mWorldHeight), kMaxScale);
+            Fit();
+        }
+
+        void Camera::Fit()
+        {
+            mView.scale = mMinScale;
+            mView.originX = 0.0f;
+            mView.originY = 0.0f;
+            Clamp();
+        }
+
+        // 🕹 DÉPLACEMENT
+        void Camera::Pan(float screenDeltaX, float screenDeltaY)
+        {
+            mView.originX -= screenDeltaX / mView.scale;
+            mView.originY -= screenDeltaY / mView.scale;
+            Clamp();
+        }
+
+        // 🔎 ZOOM
+        void Camera::ZoomAt(float factor, float screenX, float screenY)
+        {
+            if (factor <= 0.0f)
+                return;
+
+            // Point du monde sous le curseur, avant et après : il ne doit pas bouger
+            float worldX = mView.originX + screenX / mView.scale;
+            float worldY = mView.originY + screenY / mView.scale;
+            mView.scale = std::min(std::max(mView.scale * factor, mMinScale), kMaxScale);
+            mView.originX = worldX - screenX / mView.scale;
+            mView.originY = worldY - screenY / mView.scale;
+            Clamp();
+        }
+
+        void Camera::Clamp()
+        {
+            mView.scale = std::min(std::max(mView.scale, mMinScale), kMaxScale);
+
+            // Sur chaque axe : monde plus petit que l'écran → centré ; sinon l'écran reste dans le monde
+            float visibleWidth = mViewportWidth / mView.scale;
+            float visibleHeight = mViewportHeight / mView.scale;
+            if (visibleWidth >= mWorldWidth)
+                mView.originX = (mWorldWidth - visibleWidth) / 2.0f;
+            else
+                mView.originX = std::min(std::max(mView.originX, 0.0f), mWorldWidth - visibleWidth);
+            if (visibleHeight >= mWorldHeight)
+                mView.originY = (mWorldHeight - visibleHeight) / 2.0f;
+            else
+                mView.originY = std::min(std::max(mView.originY, 0.0f), mWorldHeight - visibleHeight);
+        }
+
+    } // namespace Graphics
+} // namespace Ecosystem
@@ -0,0 +1,86 @@
+#include "Graphics/Renderer.h"
+#include <algorithm> // pour std::min
+
+namespace Ecosystem
+{
+    namespace Graphics
+    {
+
+        // Nombre maximal de rectangles par appel SDL_RenderGeometry
+        // (certains pilotes n'aiment pas les tampons gigantesques)
+        static const std::size_t kRectsPerDrawCall = 16384;
+
+        // 🏗 CONSTRUCTEUR
+        Renderer::Renderer(SDL_Renderer *renderer)
+            : mRenderer(renderer), mDrawCalls(0)
+        {
+        }
+
+        // 🧹 DÉBUT D'UNE IMAGE
+        void Renderer::Begin()
+        {
+            // clear() garde la capacité : les tableaux ne sont réalloués que si l'image grossit
+            mVertices.clear();
+        }
+
+        // ⬛ AJOUT D'UN RECTANGLE PLEIN
+        void Renderer::FillRect(float x, float y, float width, float height, const Core::Color &color)
+        {
+            SDL_FColor vertexColor = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+            SDL_FPoint noTexture = {0.0f, 0.0f};
+
+            x = (x - mView.originX) * mView.scale;
+            y = (y - mView.originY) * mView.scale;
+            width *= mView.scale;
+            height *= mView.scale;
+
+            mVertices.push_back({{x, y}, vertexColor, noTexture});
+            mVertices.push_back({{x + width, y}, vertexColor, noTexture});
+            mVertices.push_back({{x + width, y + height}, vertexColor, noTexture});
+            mVertices.push_back({{x, y + height}, vertexColor, noTexture});
+        }
+
+        // 🚀 ENVOI DU LOT À SDL
+        void Renderer::Flush()
+        {
+            mDrawCalls = 0;
+            std::size_t rectCount = GetRectCount();
+            if (!mRenderer || rectCount == 0)
+            {
+                mVertices.clear();
+                return;
+            }
+
+            EnsureIndices(std::min(rectCount, kRectsPerDrawCall));
+
+            for (std::size_t first = 0; first < rectCount; first += kRectsPerDrawCall)
+            {
+                std::size_t count = std::min(kRectsPerDrawCall, rectCount - first);
+                // Les index sont relatifs au premier sommet passé : le même motif sert pour tous les lots
+                SDL_RenderGeometry(mRenderer, nullptr,
+                                   mVertices.data() + first * 4, static_cast<int>(count * 4),
+                                   mIndices.data(), static_cast<int>(count * 6));
+                mDrawCalls++;
+            }
+
+            mVertices.clear();
+        }
+
+        // 🔢 MOTIF D'INDEX (0,1,2 / 2,3,0 pour chaque rectangle), construit une seule fois
+        void Renderer::EnsureIndices(std::size_t rectCount)
+        {
+            std::size_t existing = mIndices.size() / 6;
+            for (std::size_t rect = existing; rect < rectCount; ++rect)
+            {
+                int base = static_cast<int>(rect * 4);
+                mIndices.push_back(base + 0);
+                mIndices.push_back(base + 1);
+                mIndices.push_back(base + 2);
+                mIndices.push_back(base + 2);
+                mIndices.push_back(base + 3);
+                mIndices.push_back(base + 0);
+            }
+        }
+
+    } // namespace Graphics
+} // namespace Ecosystem
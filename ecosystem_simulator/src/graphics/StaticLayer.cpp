@@ -0,0 +1,107 @@
+#include "Graphics/StaticLayer.h"
+#include "Core/Logger.h"
+#include <algorithm> // pour std::min, std::max
+#include <cmath>     // pour std::ceil
+
+namespace Ecosystem
+{
+    namespace Graphics
+    {
+
+        // 🏗 CONSTRUCTEUR / DESTRUCTEUR
+        StaticLayer::StaticLayer()
+            : mOwner(nullptr), mTexture(nullptr), mWorldWidth(0.0f), mWorldHeight(0.0f), mScale(1.0f)
+        {
+        }
+
+        StaticLayer::~StaticLayer()
+        {
+            Release();
+        }
+
+        // ⚙ CRÉATION DE LA TEXTURE
+        bool StaticLayer::Prepare(SDL_Renderer *renderer, float worldWidth, float worldHeight)
+        {
+            if (mTexture && mOwner == renderer && mWorldWidth == worldWidth && mWorldHeight == worldHeight)
+                return false;
+
+            Release();
+            if (!renderer)
+                return false;
+
+            // Échelle commune aux deux axes : les carrés restent carrés
+            float largest = std::max(worldWidth, worldHeight);
+            mScale = largest > kMaxTextureSize ? kMaxTextureSize / largest : 1.0f;
+            int width = std::max(1, static_cast<int>(std::ceil(worldWidth * mScale)));
+            int height = std::max(1, static_cast<int>(std::ceil(worldHeight * mScale)));
+
+            mTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+            if (!mTexture)
+            {
+                // Le décor sera redessiné à chaque image, comme avant
+                ECO_LOG_WARNING("⚠ Couche statique indisponible (%s)", SDL_GetError());
+                return false;
+            }
+            SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
+            SDL_SetTextureScaleMode(mTexture, mScale < 1.0f ? SDL_SCALEMODE_LINEAR : SDL_SCALEMODE_NEAREST);
+
+            mOwner = renderer;
+            mWorldWidth = worldWidth;
+            mWorldHeight = worldHeight;
+            return true;
+        }
+
+        void StaticLayer::Release()
+        {
+            if (mTexture)
+                SDL_DestroyTexture(mTexture);
+            mTexture = nullptr;
+            mOwner = nullptr;
+        }
+
+        // 🧽 RETOUCHE DES TUILES MARQUÉES
+        void StaticLayer::BeginPatch(Renderer &batch, const Core::DirtyRegions &dirty)
+        {
+            // Ce qui attend dans le lot va à l'écran, pas dans la texture
+            batch.Flush();
+
+            mSavedView = batch.GetView();
+            Renderer::View textureView;
+            textureView.scale = mScale;
+            batch.SetView(textureView);
+
+            // Les tuiles sont remplacées par du transparent (écriture sans mélange, voir EndPatch)
+            dirty.ForEachDirtyTile([&batch](float x, float y, float width, float height)
+                                   { batch.FillRect(x, y, width, height, Core::Color(0, 0, 0, 0)); });
+        }
+
+        void StaticLayer::EndPatch(Renderer &batch)
+        {
+            SDL_Renderer *renderer = batch.GetSDLRenderer();
+            SDL_BlendMode previousBlend = SDL_BLENDMODE_BLEND;
+            SDL_GetRenderDrawBlendMode(renderer, &previousBlend);
+
+            SDL_SetRenderTarget(renderer, mTexture);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            batch.Flush();
+            SDL_SetRenderDrawBlendMode(renderer, previousBlend);
+            SDL_SetRenderTarget(renderer, nullptr);
+
+            batch.SetView(mSavedView);
+        }
+
+        // 🎨 AFFICHAGE
+        void StaticLayer::Draw(Renderer &batch) const
+        {
+            if (!mTexture)
+                return;
+            // Ce qui attend déjà dans le lot reste dessous
+            batch.Flush();
+            const Renderer::View &view = batch.GetView();
+            SDL_FRect destination = {(0.0f - view.originX) * view.scale, (0.0f - view.originY) * view.scale,
+                                     mWorldWidth * view.scale, mWorldHeight * view.scale};
+            SDL_RenderTexture(batch.GetSDLRenderer(), mTexture, nullptr, &destination);
+        }
+
+    } // namespace Graphics
+} // namespace Ecosystem
@@ -1,5 +1,5 @@
 #include "Graphics/Window.h"
-#include <iostream> // pour std::cout et std::cerr
+#include "Core/Logger.h" // pour ECO_LOG_INFO / ECO_LOG_ERROR
 
 namespace Ecosystem
 {
@@ -23,7 +23,7 @@ namespace Ecosystem
             // Initialisation du sous-système Vidéo de SDL
             if (SDL_Init(SDL_INIT_VIDEO) != 0)
             {
-                std::cerr << "❌ Erreur SDL_Init: " << SDL_GetError() << std::endl;
+                ECO_LOG_ERROR("❌ Erreur SDL_Init: %s", SDL_GetError());
                 return false;
             }
 
@@ -36,7 +36,7 @@ namespace Ecosystem
 
             if (!mWindow)
             {
-                std::cerr << "❌ Erreur création fenêtre: " << SDL_GetError() << std::endl;
+                ECO_LOG_ERROR("❌ Erreur création fenêtre: %s", SDL_GetError());
                 SDL_Quit();
                 return false;
             }
@@ -48,7 +48,7 @@ namespace Ecosystem
             if (!mRenderer)
             {
                 // Correction : Ligne rétablie (point-virgule et endl ajoutés)
-                std::cerr << "❌ Erreur création renderer: " << SDL_GetError() << std::endl;
+                ECO_LOG_ERROR("❌ Erreur création renderer: %s", SDL_GetError());
                 SDL_DestroyWindow(mWindow);
                 SDL_Quit();
                 return false;
@@ -56,7 +56,7 @@ namespace Ecosystem
 
             mIsInitialized = true;
             // Correction : Ligne rétablie (fermeture des guillemets et affichage complet)
-            std::cout << "✅ Fenêtre initialisée: " << mTitle << " (" << mWidth << "x" << mHeight << ")" << std::endl;
+            ECO_LOG_INFO("✅ Fenêtre initialisée: %s (%gx%g)", mTitle.c_str(), mWidth, mHeight);
             return true;
         }
 
@@ -76,7 +76,7 @@ namespace Ecosystem
             // Quitter proprement SDL
             SDL_Quit();
             mIsInitialized = false;
-            std::cout << "🔄 Fenêtre fermée" << std::endl;
+            ECO_LOG_INFO("🔄 Fenêtre fermée");
         }
 
         // 🧹 NETTOYAGE DE L'ÉCRAN
@@ -1,43 +1,250 @@
 // src/main.cpp
 
 // Inclusions requises
-#include "Core/GameEngine.hpp"
+#include "Core/GameEngine.h"
+#include "Core/HeadlessRunner.h"
+#include "Core/Logger.h"
+#include "Core/ReplayLog.h"
+#include "Core/WorldConfig.h"
 #include <iostream>
-#include <cstdlib>
-#include <ctime>
+#include <cmath>   // Pour std::isfinite
+#include <cstdlib> // Pour std::strtoll, std::strtof
+#include <cstring> // Pour std::strcmp
+#include <string>
+#include <vector>
+
+// 📖 AIDE DE LA LIGNE DE COMMANDE
+static void PrintUsage(const char *program)
+{
+    std::cout << "Usage: " << program << " [options]" << std::endl;
+    std::cout << "  --headless      Simulation sans fenêtre, aussi vite que possible" << std::endl;
+    std::cout << "  --ticks N       Nombre de ticks en mode headless (0 = jusqu'à l'extinction, défaut 10000)" << std::endl;
+    std::cout << "  --dt SECONDES   Pas de temps fixe en mode headless (défaut 0.016667)" << std::endl;
+    std::cout << "  --profile-csv F Mode headless : durée de chaque phase, tick par tick, dans le fichier F" << std::endl;
+    std::cout << "  --load-snapshot F Démarre depuis la sauvegarde F au lieu de la population de départ" << std::endl;
+    std::cout << "  --save-snapshot F Headless : sauvegarde en fin d'exécution ; fenêtré : fichier de F5/F9" << std::endl;
+    std::cout << "  --snapshot-every N Mode headless : sauvegarde aussi tous les N ticks (points de reprise)" << std::endl;
+    std::cout << "  --record F      Journal de rejeu : commandes du joueur et empreinte de l'état à chaque tick" << std::endl;
+    std::cout << "  --replay F      Rejoue le journal F (même --config/--set/--load-snapshot) et affiche" << std::endl;
+    std::cout << "                  le premier tick qui diverge" << std::endl;
+    std::cout << "  --stats-file F  Population, énergie moyenne, naissances, morts, repas et nourriture" << std::endl;
+    std::cout << "                  de chaque tick, dans un fichier binaire en colonnes" << std::endl;
+    std::cout << "  --sim-rate HZ   Pas de simulation par seconde en mode fenêtré (défaut 60)" << std::endl;
+    std::cout << "  --seed N        Graine du monde : la même graine rejoue la même simulation" << std::endl;
+    std::cout << "  --config F      Configuration du monde (fichier clé = valeur, voir config/world.cfg)" << std::endl;
+    std::cout << "  --set CLÉ=VAL   Remplace une clé de la configuration (répétable, après --config)" << std::endl;
+    std::cout << "  --log-level NIV trace, debug, info, warning, error ou off (défaut info)" << std::endl;
+    std::cout << "  --help          Affiche cette aide" << std::endl;
+}
+
+// 🔢 VALEURS NUMÉRIQUES DES OPTIONS
+// Tout le texte doit être lu : "12abc" ou "" sont refusés au lieu de devenir 0
+static bool ParseCount(const char *text, int64_t &out)
+{
+    char *end = nullptr;
+    long long parsed = std::strtoll(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < 0)
+        return false;
+    out = parsed;
+    return true;
+}
+
+// Durée ou fréquence : finie et strictement positive
+static bool ParsePositive(const char *text, float &out)
+{
+    char *end = nullptr;
+    float parsed = std::strtof(text, &end);
+    if (end == text || *end != '\0' || !std::isfinite(parsed) || parsed <= 0.0f)
+        return false;
+    out = parsed;
+    return true;
+}
 
 int main(int argc, char *argv[])
 {
+    // 🧾 LECTURE DES ARGUMENTS
+    bool headless = false;
+    float simulationRate = 60.0f;
+    Ecosystem::Core::LogLevel logLevel = Ecosystem::Core::LogLevel::Info;
+    Ecosystem::Core::HeadlessRunner::Options headlessOptions;
+    std::string loadSnapshotPath;
+    std::string saveSnapshotPath;
+    std::string recordPath;
+    std::string replayPath;
+    std::string statsPath;
+    Ecosystem::Core::WorldConfig config;
+    std::vector<std::string> overrides; // --set, appliqués après le fichier
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--headless") == 0)
+        {
+            headless = true;
+        }
+        else if (std::strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+        {
+            if (!ParseCount(argv[++i], headlessOptions.maxTicks))
+            {
+                ECO_LOG_ERROR("❌ --ticks attend un nombre entier positif ou nul: %s", argv[i]);
+                return -1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--dt") == 0 && i + 1 < argc)
+        {
+            if (!ParsePositive(argv[++i], headlessOptions.timeStep))
+            {
+                ECO_LOG_ERROR("❌ --dt attend une durée strictement positive: %s", argv[i]);
+                return -1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--profile-csv") == 0 && i + 1 < argc)
+        {
+            headlessOptions.profileCsvPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--load-snapshot") == 0 && i + 1 < argc)
+        {
+            loadSnapshotPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--save-snapshot") == 0 && i + 1 < argc)
+        {
+            saveSnapshotPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--snapshot-every") == 0 && i + 1 < argc)
+        {
+            if (!ParseCount(argv[++i], headlessOptions.snapshotInterval))
+            {
+                ECO_LOG_ERROR("❌ --snapshot-every attend un nombre entier positif ou nul: %s", argv[i]);
+                return -1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+        {
+            recordPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+        {
+            replayPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--stats-file") == 0 && i + 1 < argc)
+        {
+            statsPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--sim-rate") == 0 && i + 1 < argc)
+        {
+            if (!ParsePositive(argv[++i], simulationRate))
+            {
+                ECO_LOG_ERROR("❌ --sim-rate attend une fréquence strictement positive: %s", argv[i]);
+                return -1;
+            }
+        }
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            overrides.push_back(std::string("seed=") + argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--config") == 0 && i + 1 < argc)
+        {
+            if (!config.LoadFile(argv[++i]))
+                return -1;
+        }
+        else if (std::strcmp(argv[i], "--set") == 0 && i + 1 < argc)
+        {
+            overrides.push_back(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--log-level") == 0 && i + 1 < argc &&
+                 Ecosystem::Core::Logger::ParseLevel(argv[i + 1], logLevel))
+        {
+            ++i;
+        }
+        else
+        {
+            PrintUsage(argv[0]);
+            return std::strcmp(argv[i], "--help") == 0 ? 0 : -1;
+        }
+    }
 
-    // 🎲 Initialisation de l'aléatoire (pour les positions et directions)
-    // Utilise l'heure actuelle comme graine
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+    Ecosystem::Core::Logger::Instance().SetLevel(logLevel);
 
-    std::cout << "🎮 Démarrage du Simulateur d'Écosystème" << std::endl;
-    std::cout << "=======================================" << std::endl;
+    // 🗺 Configuration du monde : valeurs par défaut, puis fichier, puis ligne de commande
+    for (const std::string &assignment : overrides)
+    {
+        if (!config.SetFromAssignment(assignment))
+        {
+            ECO_LOG_ERROR("❌ Réglage invalide: %s", assignment.c_str());
+            return -1;
+        }
+    }
+    if (!config.Validate())
+        return -1;
+
+    ECO_LOG_INFO("🎮 Démarrage du Simulateur d'Écosystème");
+    ECO_LOG_INFO("=======================================");
+
+    // 🎬 Rejeu d'un journal : toujours sans fenêtre
+    if (!replayPath.empty())
+    {
+        Ecosystem::Core::Ecosystem ecosystem(config);
+        Ecosystem::Core::ReplayLog::Result result = Ecosystem::Core::ReplayLog::Replay(ecosystem, replayPath, loadSnapshotPath);
+        Ecosystem::Core::ReplayLog::PrintResult(result);
+        return result.ok ? 0 : 1;
+    }
+
+    // 🖥 Mode sans fenêtre : pas de GameEngine, donc ni SDL ni limitation à 60 FPS
+    if (headless)
+    {
+        Ecosystem::Core::HeadlessRunner runner(config);
+        runner.Initialize();
+        if (!loadSnapshotPath.empty() && !runner.LoadSnapshot(loadSnapshotPath))
+            return -1;
+        headlessOptions.snapshotPath = saveSnapshotPath;
+        headlessOptions.recordPath = recordPath;
+        headlessOptions.statsPath = statsPath;
+        Ecosystem::Core::HeadlessRunner::Report report = runner.Run(headlessOptions);
+        if (report.failed)
+            return -1;
+        Ecosystem::Core::HeadlessRunner::PrintReport(report);
+        return 0;
+    }
 
     // 🏗 Création du moteur de jeu
     // Le constructeur est appelé ici, ce qui appelle les constructeurs de Window et Ecosystem
-    Ecosystem::Core::GameEngine engine("Simulateur d'Écosystème Intelligent", 1200.0f, 800.0f);
+    Ecosystem::Core::GameEngine engine("Simulateur d'Écosystème Intelligent", config);
+    engine.SetSimulationRate(simulationRate);
+    if (!saveSnapshotPath.empty())
+        engine.SetSnapshotPath(saveSnapshotPath);
 
     // ⚙ Initialisation
     if (!engine.Initialize())
     {
         // Correction de la ligne coupée
-        std::cerr << "❌ Erreur: Impossible d'initialiser le moteur de jeu" << std::endl;
+        ECO_LOG_ERROR("❌ Erreur: Impossible d'initialiser le moteur de jeu");
+        return -1;
+    }
+
+    if (!loadSnapshotPath.empty() && !engine.LoadSnapshot(loadSnapshotPath))
+    {
+        engine.Shutdown();
+        return -1;
+    }
+
+    if ((!recordPath.empty() && !engine.StartRecording(recordPath)) ||
+        (!statsPath.empty() && !engine.OpenStatisticsFile(statsPath)))
+    {
+        engine.Shutdown();
         return -1;
     }
 
-    std::cout << "✅ Moteur initialisé avec succès" << std::endl;
-    std::cout << "🎯 Lancement de la simulation..." << std::endl;
+    ECO_LOG_INFO("✅ Moteur initialisé avec succès");
+    ECO_LOG_INFO("🎯 Lancement de la simulation...");
 
     // Affichage des contrôles pour l'utilisateur
-    std::cout << "=== CONTRÔLES ===" << std::endl;
-    std::cout << "ESPACE: Pause/Reprise" << std::endl;
-    std::cout << "R: Reset simulation" << std::endl;
-    std::cout << "F: Ajouter nourriture" << std::endl;
-    std::cout << "FLÈCHES HAUT/BAS: Vitesse simulation" << std::endl;
-    std::cout << "ÉCHAP: Quitter" << std::endl;
+    ECO_LOG_INFO("=== CONTRÔLES ===");
+    ECO_LOG_INFO("ESPACE: Pause/Reprise");
+    ECO_LOG_INFO("R: Reset simulation");
+    ECO_LOG_INFO("F: Ajouter nourriture");
+    ECO_LOG_INFO("FLÈCHES HAUT/BAS: Vitesse simulation");
+    ECO_LOG_INFO("P: Afficher/masquer le profileur");
+    ECO_LOG_INFO("F5/F9: Sauvegarder/recharger la simulation");
+    ECO_LOG_INFO("ÉCHAP: Quitter");
 
     // ▶️ Boucle principale
     engine.Run();
@@ -46,6 +253,6 @@ int main(int argc, char *argv[])
     // Le destructeur de 'engine' est appelé automatiquement à la fin de 'main'
     engine.Shutdown();
 
-    std::cout << "👋 Simulation terminée. Au revoir !" << std::endl;
+    ECO_LOG_INFO("👋 Simulation terminée. Au revoir !");
     return 0;
 }
\ No newline at end of file